@@ -1,11 +1,55 @@
 #include "Algorithm.h"
+#include "EdgeFlagFill.h"
+#include "LineRasterizer.h"
+#include "PolygonClip.h"
+#include "ScanlineFill.h"
+#include "SeedFill.h"
+#include <climits>
+
+// 裁剪时窗口外扩的像素数：栅格化后的像素与理想直线在次方向上最多相差半个像素，
+// 多留的部分同时吸收浮点裁剪的舍入误差
+static const int kLineClipMargin = 2;
+
+// 用 Cohen-Sutherland 把整数端点的直线裁剪到 [xmin, xmax] x [ymin, ymax]，
+// 得到可能有可见像素的主方向步数范围 [first, last]；整条直线都在窗口外时返回 false
+static bool ClipLineSteps(int x0, int y0, int x1, int y1, int xmin, int ymin, int xmax, int ymax, int& first, int& last)
+{
+    float cx0 = static_cast<float>(x0), cy0 = static_cast<float>(y0);
+    float cx1 = static_cast<float>(x1), cy1 = static_cast<float>(y1);
+    if (!CohenSutherlandLineClip(cx0, cy0, cx1, cy1,
+            static_cast<float>(xmin - kLineClipMargin), static_cast<float>(ymin - kLineClipMargin),
+            static_cast<float>(xmax + kLineClipMargin), static_cast<float>(ymax + kLineClipMargin)))
+        return false;
+
+    // 裁剪后的端点仍在原直线上，到起点的主方向距离就是步数
+    bool is_steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+    float t0 = is_steep ? std::abs(cy0 - y0) : std::abs(cx0 - x0);
+    float t1 = is_steep ? std::abs(cy1 - y0) : std::abs(cx1 - x0);
+    first = static_cast<int>(std::floor(std::min(t0, t1))) - kLineClipMargin;
+    last = static_cast<int>(std::ceil(std::max(t0, t1))) + kLineClipMargin;
+    return true;
+}
 
-// 使用 DDA 算法绘制直线
-void DrawLineDDA(ImDrawList* draw_list,
-    ImVec2 start,
-    ImVec2 end,
-    ImU32 color,
-    float radius)
+// 按目标的可见范围求步数范围，目标不限制范围时返回整条直线
+static bool ClipLineSteps(const RasterTarget& target, int x0, int y0, int x1, int y1, int& first, int& last)
+{
+    first = 0;
+    last = INT_MAX;
+    int xmin, ymin, xmax, ymax;
+    if (!target.GetClipRect(xmin, ymin, xmax, ymax))
+        return true;
+    return ClipLineSteps(x0, y0, x1, y1, xmin, ymin, xmax, ymax, first, last);
+}
+
+// 浮点步数换算成 int：负数和 NaN 为 0，超出范围时截断到 INT_MAX - 1，循环 i <= last 不会溢出
+static int ClampStep(double v)
+{
+    if (!(v > 0.0))
+        return 0;
+    return v >= INT_MAX - 1 ? INT_MAX - 1 : static_cast<int>(v);
+}
+
+bool SetupLineDDA(const RasterTarget* target, ImVec2 start, ImVec2 end, LineDDASetup& dda)
 {
     // 计算增量
     float dx = end.x - start.x;
@@ -14,28 +58,185 @@ void DrawLineDDA(ImDrawList* draw_list,
     // 确定步数（绝对值更大的轴方向决定步数）
     float steps = std::max(std::abs(dx), std::abs(dy));
 
-    // 计算每一步的增量
-    float x_inc = dx / steps;
-    float y_inc = dy / steps;
+    // 计算每一步的增量（起点终点重合时只画一个点）
+    dda.x_inc = steps > 0.0f ? dx / steps : 0.0f;
+    dda.y_inc = steps > 0.0f ? dy / steps : 0.0f;
+
+    // 端点不是有限值时没有可画的像素
+    if (!std::isfinite(steps))
+        return false;
+
+    // 只走可能有可见像素的步数范围 [first, last]；整条直线都在可见范围外时直接返回
+    // 主方向每步恰好前进一个像素，裁剪后端点到起点的主方向距离就是步数
+    dda.first = 0;
+    dda.last = ClampStep(steps);
+    int xmin, ymin, xmax, ymax;
+    if (target && target->GetClipRect(xmin, ymin, xmax, ymax)) {
+        float cx0 = start.x, cy0 = start.y, cx1 = end.x, cy1 = end.y;
+        if (!CohenSutherlandLineClip(cx0, cy0, cx1, cy1,
+                static_cast<float>(xmin - kLineClipMargin), static_cast<float>(ymin - kLineClipMargin),
+                static_cast<float>(xmax + kLineClipMargin), static_cast<float>(ymax + kLineClipMargin)))
+            return false;
+        bool is_steep = std::abs(dy) > std::abs(dx);
+        float t0 = is_steep ? std::abs(cy0 - start.y) : std::abs(cx0 - start.x);
+        float t1 = is_steep ? std::abs(cy1 - start.y) : std::abs(cx1 - start.x);
+        dda.first = ClampStep(std::floor(static_cast<double>(std::min(t0, t1))) - kLineClipMargin);
+        dda.last = std::min(dda.last, ClampStep(std::ceil(static_cast<double>(std::max(t0, t1))) + kLineClipMargin));
+        if (dda.first > dda.last)
+            return false;
+    }
 
-    // 起始点
-    float x = start.x;
-    float y = start.y;
+    // 第 first 步的坐标直接算出，不再从起点逐步累加
+    // 跳过一段后与逐步累加的结果可能差一个舍入误差，累加本身在长线上的误差比这更大
+    dda.x = dda.first > 0 ? static_cast<float>(start.x + static_cast<double>(dda.first) * dda.x_inc) : start.x;
+    dda.y = dda.first > 0 ? static_cast<float>(start.y + static_cast<double>(dda.first) * dda.y_inc) : start.y;
+    return true;
+}
 
-    // 绘制每一个点（用圆形代替矩形）
-    for (int i = 0; i <= steps; i++) {
-        draw_list->AddCircleFilled(ImVec2(x, y), radius, color); // 绘制一个圆形点
-        x += x_inc; // 更新 X 坐标
-        y += y_inc; // 更新 Y 坐标
+// 使用 DDA 算法绘制直线
+void DrawLineDDA(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color)
+{
+    LineDDASetup dda;
+    if (!SetupLineDDA(&target, start, end, dda))
+        return;
+
+    target.Reserve(dda.last - dda.first + 1);
+
+    // 绘制每一个点，坐标四舍五入到最近的像素
+    float x = dda.x;
+    float y = dda.y;
+    for (int i = dda.first; i <= dda.last; i++) {
+        target.Plot(static_cast<int>(std::floor(x + 0.5f)), static_cast<int>(std::floor(y + 0.5f)), color);
+        x += dda.x_inc; // 更新 X 坐标
+        y += dda.y_inc; // 更新 Y 坐标
     }
 }
 
-// 使用中点算法绘制直线
-void DrawLineMidpoint(ImDrawList* draw_list,
+void DrawLineDDA(ImDrawList* draw_list,
     ImVec2 start,
     ImVec2 end,
     ImU32 color,
-    float radius)
+    float radius,
+    PixelStyle style)
+{
+    DrawListTarget target(draw_list, ImVec2(0.0f, 0.0f), radius, style);
+    DrawLineDDA(target, start, end, color);
+}
+
+// 定点 DDA 的裁剪：主方向直接换算成步数范围，次方向只做整体剔除，全部是精确的整数运算
+// 次方向超出窗口的部分最多只多走一个窗口宽度，由目标自己丢弃
+static bool ClipFixedLineSteps(int x0, int y0, int x1, int y1, int xmin, int ymin, int xmax, int ymax, long long& first, long long& last)
+{
+    if (std::max(x0, x1) < xmin || std::min(x0, x1) > xmax || std::max(y0, y1) < ymin || std::min(y0, y1) > ymax)
+        return false;
+
+    long long dx = static_cast<long long>(x1) - x0;
+    long long dy = static_cast<long long>(y1) - y0;
+    bool is_steep = std::llabs(dy) > std::llabs(dx);
+    long long major0 = is_steep ? y0 : x0;
+    long long dmajor = is_steep ? dy : dx;
+    long long lo = is_steep ? ymin : xmin;
+    long long hi = is_steep ? ymax : xmax;
+    if (dmajor >= 0) {
+        first = lo - major0;
+        last = hi - major0;
+    } else {
+        first = major0 - hi;
+        last = major0 - lo;
+    }
+    return true;
+}
+
+static bool ClipFixedLineSteps(const RasterTarget& target, int x0, int y0, int x1, int y1, long long& first, long long& last)
+{
+    first = 0;
+    last = LLONG_MAX;
+    int xmin, ymin, xmax, ymax;
+    if (!target.GetClipRect(xmin, ymin, xmax, ymax))
+        return true;
+    return ClipFixedLineSteps(x0, y0, x1, y1, xmin, ymin, xmax, ymax, first, last);
+}
+
+// 浮点端点四舍五入到最近的整数像素，超出 int 范围的部分截断
+static int RoundToPixel(float v)
+{
+    double rounded = std::floor(static_cast<double>(v) + 0.5);
+    return static_cast<int>(std::max<double>(INT_MIN, std::min<double>(INT_MAX, rounded)));
+}
+
+void DrawLineDDAFixed(RasterTarget& target,
+    int x0,
+    int y0,
+    int x1,
+    int y1,
+    ImU32 color)
+{
+    long long first, last;
+    if (!ClipFixedLineSteps(target, x0, y0, x1, y1, first, last))
+        return;
+
+    if (PixelBuffer* buffer = target.AsPixelBuffer(std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1))) {
+        if (buffer->Contains(x0, y0) && buffer->Contains(x1, y1)) {
+            BufferPlot<false> plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+            RasterizeLineFixed(x0, y0, x1, y1, plot, first, last);
+        } else {
+            BufferPlot<true> plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+            RasterizeLineFixed(x0, y0, x1, y1, plot, first, last);
+        }
+        return;
+    }
+
+    long long steps = std::max(std::llabs(static_cast<long long>(x1) - x0), std::llabs(static_cast<long long>(y1) - y0));
+    target.Reserve(static_cast<int>(std::min<long long>(INT_MAX, std::min(last, steps) - std::max(first, 0LL) + 1)));
+    TargetPlot plot { target, color };
+    RasterizeLineFixed(x0, y0, x1, y1, plot, first, last);
+}
+
+void DrawLineDDAFixed(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color)
+{
+    DrawLineDDAFixed(target, RoundToPixel(start.x), RoundToPixel(start.y), RoundToPixel(end.x), RoundToPixel(end.y), color);
+}
+
+void DrawLineDDAFixed(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius,
+    PixelStyle style)
+{
+    if (style != PIXEL_QUAD) {
+        DrawListTarget target(draw_list, ImVec2(0.0f, 0.0f), radius, style);
+        DrawLineDDAFixed(target, start, end, color);
+        return;
+    }
+
+    int x0 = RoundToPixel(start.x);
+    int y0 = RoundToPixel(start.y);
+    int x1 = RoundToPixel(end.x);
+    int y1 = RoundToPixel(end.y);
+
+    long long first = 0, last = LLONG_MAX;
+    int xmin, ymin, xmax, ymax;
+    if (GetDrawListClipRect(draw_list, ImVec2(0.0f, 0.0f), radius, xmin, ymin, xmax, ymax)
+        && !ClipFixedLineSteps(x0, y0, x1, y1, xmin, ymin, xmax, ymax, first, last))
+        return;
+
+    long long steps = std::max(std::llabs(static_cast<long long>(x1) - x0), std::llabs(static_cast<long long>(y1) - y0));
+    DrawListQuadPlot plot(draw_list, ImVec2(0.0f, 0.0f), radius, color,
+        static_cast<int>(std::min<long long>(INT_MAX, std::min(last, steps) - std::max(first, 0LL) + 1)));
+    RasterizeLineFixed(x0, y0, x1, y1, plot, first, last);
+}
+
+// 中点算法和 Bresenham 算法的决策变量完全相同，共用按八分象限特化的内核（见 LineRasterizer.h）
+// 目标能给出 PixelBuffer 时直接写内存，两端点都在缓冲区内时连越界判断也省掉；其他目标走虚函数
+// 端点在可见范围外时先裁剪，决策变量直接跳到第一个可能可见的像素，输出与不裁剪时逐像素相同
+static void RasterizeLineToTarget(RasterTarget& target, ImVec2 start, ImVec2 end, ImU32 color)
 {
     // 起点和终点的整数坐标
     int x0 = static_cast<int>(start.x);
@@ -43,144 +244,308 @@ void DrawLineMidpoint(ImDrawList* draw_list,
     int x1 = static_cast<int>(end.x);
     int y1 = static_cast<int>(end.y);
 
-    // 计算增量
-    int dx = x1 - x0;
-    int dy = y1 - y0;
+    PixelBuffer* buffer = target.AsPixelBuffer(std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1));
+    if (buffer && buffer->Contains(x0, y0) && buffer->Contains(x1, y1)) {
+        BufferPlot<false> plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+        RasterizeLine(x0, y0, x1, y1, plot);
+        return;
+    }
 
-    // 确定直线的方向
-    int x_step = (dx > 0) ? 1 : -1;
-    int y_step = (dy > 0) ? 1 : -1;
+    int first, last;
+    if (!ClipLineSteps(target, x0, y0, x1, y1, first, last))
+        return;
 
-    dx = std::abs(dx);
-    dy = std::abs(dy);
+    if (buffer) {
+        BufferPlot<true> plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+        RasterizeLine(x0, y0, x1, y1, plot, first, last);
+        return;
+    }
 
-    // 主方向判断
-    bool is_steep = dy > dx;
+    int steps = std::max(std::abs(x1 - x0), std::abs(y1 - y0));
+    target.Reserve(std::min(last, steps) - std::max(first, 0) + 1);
+    TargetPlot plot { target, color };
+    RasterizeLine(x0, y0, x1, y1, plot, first, last);
+}
 
-    if (is_steep) {
-        std::swap(dx, dy); // 如果斜率较大，交换 dx 和 dy
+// 四边形模式直接写顶点缓冲，不经过 DrawListTarget 的虚函数
+static void RasterizeLineToDrawList(ImDrawList* draw_list, ImVec2 start, ImVec2 end, ImU32 color, float radius, PixelStyle style)
+{
+    if (style != PIXEL_QUAD) {
+        DrawListTarget target(draw_list, ImVec2(0.0f, 0.0f), radius, style);
+        RasterizeLineToTarget(target, start, end, color);
+        return;
     }
 
-    int d = 2 * dy - dx; // 初始化决策变量
-    int incE = 2 * dy; // 增量（沿主方向）
-    int incNE = 2 * (dy - dx); // 增量（沿次方向）
+    int x0 = static_cast<int>(start.x);
+    int y0 = static_cast<int>(start.y);
+    int x1 = static_cast<int>(end.x);
+    int y1 = static_cast<int>(end.y);
 
-    int x = x0;
-    int y = y0;
+    int first = 0, last = INT_MAX;
+    int xmin, ymin, xmax, ymax;
+    if (GetDrawListClipRect(draw_list, ImVec2(0.0f, 0.0f), radius, xmin, ymin, xmax, ymax)
+        && !ClipLineSteps(x0, y0, x1, y1, xmin, ymin, xmax, ymax, first, last))
+        return;
 
-    // 绘制第一个点
-    draw_list->AddCircleFilled(ImVec2(x, y), radius, color);
+    int steps = std::max(std::abs(x1 - x0), std::abs(y1 - y0));
+    DrawListQuadPlot plot(draw_list, ImVec2(0.0f, 0.0f), radius, color, std::min(last, steps) - std::max(first, 0) + 1);
+    RasterizeLine(x0, y0, x1, y1, plot, first, last);
+}
 
-    // 绘制其余点
-    for (int i = 0; i < dx; ++i) {
-        if (d > 0) {
-            if (is_steep) {
-                y += y_step;
-            } else {
-                x += x_step;
-            }
-            d += incNE; // 更新决策变量
-        } else {
-            d += incE; // 更新决策变量
-        }
+static void RasterizeLineToPixels(std::vector<PixelCoord>& pixels, ImVec2 start, ImVec2 end)
+{
+    int x0 = static_cast<int>(start.x);
+    int y0 = static_cast<int>(start.y);
+    int x1 = static_cast<int>(end.x);
+    int y1 = static_cast<int>(end.y);
+    PixelCollector plot { pixels };
+    RasterizeLine(x0, y0, x1, y1, plot);
+}
 
-        if (is_steep) {
-            x += x_step;
-        } else {
-            y += y_step;
-        }
+// 使用中点算法绘制直线
+void DrawLineMidpoint(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color)
+{
+    RasterizeLineToTarget(target, start, end, color);
+}
 
-        draw_list->AddCircleFilled(ImVec2(x, y), radius, color); // 绘制点
-    }
+void DrawLineMidpoint(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius,
+    PixelStyle style)
+{
+    RasterizeLineToDrawList(draw_list, start, end, color, radius, style);
+}
+
+void DrawLineMidpoint(std::vector<PixelCoord>& pixels,
+    ImVec2 start,
+    ImVec2 end)
+{
+    RasterizeLineToPixels(pixels, start, end);
+}
+
+void DrawLineBresenham(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color)
+{
+    RasterizeLineToTarget(target, start, end, color);
 }
 
 void DrawLineBresenham(ImDrawList* draw_list,
     ImVec2 start,
     ImVec2 end,
     ImU32 color,
-    float radius)
+    float radius,
+    PixelStyle style)
 {
-    // 起点和终点的整数坐标
-    int x0 = static_cast<int>(start.x);
-    int y0 = static_cast<int>(start.y);
-    int x1 = static_cast<int>(end.x);
-    int y1 = static_cast<int>(end.y);
+    RasterizeLineToDrawList(draw_list, start, end, color, radius, style);
+}
 
-    // 计算增量
+void DrawLineBresenham(std::vector<PixelCoord>& pixels,
+    ImVec2 start,
+    ImVec2 end)
+{
+    RasterizeLineToPixels(pixels, start, end);
+}
+
+namespace {
+
+// 游程输出到 PixelBuffer：直接写内存，超出缓冲区的部分截掉
+struct BufferRunPlot {
+    ImU32* pixels;
+    int width;
+    int height;
+    ImU32 color;
+
+    void Span(int xa, int xb, int y)
+    {
+        if (static_cast<unsigned>(y) >= static_cast<unsigned>(height))
+            return;
+        xa = std::max(xa, 0);
+        xb = std::min(xb, width - 1);
+        ImU32* row = pixels + static_cast<size_t>(y) * width;
+        for (int x = xa; x <= xb; ++x)
+            row[x] = color;
+    }
+
+    void VSpan(int x, int ya, int yb)
+    {
+        if (static_cast<unsigned>(x) >= static_cast<unsigned>(width))
+            return;
+        ya = std::max(ya, 0);
+        yb = std::min(yb, height - 1);
+        ImU32* p = pixels + static_cast<size_t>(ya) * width + x;
+        for (int y = ya; y <= yb; ++y, p += width)
+            *p = color;
+    }
+};
+
+// 游程输出到其他目标：每个游程一次 PlotSpan / PlotVSpan
+struct TargetRunPlot {
+    RasterTarget& target;
+    ImU32 color;
+
+    void Span(int xa, int xb, int y) { target.PlotSpan(xa, xb, y, color); }
+    void VSpan(int x, int ya, int yb) { target.PlotVSpan(x, ya, yb, color); }
+};
+
+} // namespace
+
+// 写入 PixelBuffer 时，平均游程短于这个长度的直线改为逐像素绘制
+static const int kMinRunLength = 3;
+
+// 按游程（run）绘制直线：与 Bresenham 逐像素的结果完全相同，但每一段连续像素只输出一次
+// 对 x 为主方向的直线，第 i 个像素的次方向偏移为 m(i) = ceil((2dy*i - dx) / (2dx))，
+// 所以偏移为 m 的游程结束于 i = floor((2dx*m + dx) / (2dy))
+// 只有第一个游程做除法，之后分子每次增加 2dx，商和余数增量更新
+static void DrawLineRunSlice(RasterTarget& target, int x0, int y0, int x1, int y1, ImU32 color)
+{
     int dx = std::abs(x1 - x0);
     int dy = std::abs(y1 - y0);
-
-    // 确定直线的方向
     int x_step = (x1 > x0) ? 1 : -1;
     int y_step = (y1 > y0) ? 1 : -1;
 
-    // 判断直线的主方向
     bool is_steep = dy > dx;
     if (is_steep) {
-        std::swap(dx, dy); // 如果斜率大于 1，交换 dx 和 dy
+        std::swap(dx, dy);
     }
 
-    int d = 2 * dy - dx; // 初始化决策变量
-    int incE = 2 * dy; // 沿主方向的增量
-    int incNE = 2 * (dy - dx); // 沿次方向的增量
-
-    int x = x0;
-    int y = y0;
-
-    // 绘制第一个点
-    draw_list->AddCircleFilled(ImVec2(x, y), radius, color);
-
-    // 按 Bresenham 算法绘制其余的点
-    for (int i = 0; i < dx; ++i) {
-        if (d > 0) {
+    // 只处理可能可见的步数范围 [first, last]，其中的游程与不裁剪时相同
+    int first, last;
+    if (!ClipLineSteps(target, x0, y0, x1, y1, first, last))
+        return;
+    first = std::max(first, 0);
+    last = std::min(last, dx);
+    if (first > last)
+        return;
+
+    // 第 i 步所在的游程（次方向偏移）
+    auto run_of = [&](int i) {
+        long long numerator = 2LL * dy * i - dx;
+        return numerator > 0 ? static_cast<int>((numerator + 2LL * dx - 1) / (2LL * dx)) : 0;
+    };
+    int first_run = run_of(first);
+    int last_run = run_of(last);
+
+    auto rasterize = [&](auto& plot) {
+        // 游程 m 的终点为 run_end = floor(numerator / denominator)，其中 numerator = 2dx*m + dx
+        const long long denominator = 2LL * std::max(dy, 1);
+        long long numerator = 2LL * dx * first_run + dx;
+        long long run_end = dy > 0 ? numerator / denominator : last;
+        long long remainder = numerator % denominator;
+        const long long end_step = 2LL * dx / denominator;
+        const long long remainder_step = 2LL * dx % denominator;
+
+        int i = first; // 游程起点（沿主方向的步数）
+        for (int m = first_run; m <= last_run; ++m) {
+            int end = static_cast<int>(std::min<long long>(run_end, last));
             if (is_steep) {
-                x += x_step;
+                int ya = y0 + y_step * i;
+                int yb = y0 + y_step * end;
+                plot.VSpan(x0 + x_step * m, std::min(ya, yb), std::max(ya, yb));
             } else {
-                y += y_step;
+                int xa = x0 + x_step * i;
+                int xb = x0 + x_step * end;
+                plot.Span(std::min(xa, xb), std::max(xa, xb), y0 + y_step * m);
+            }
+            i = end + 1;
+            run_end += end_step;
+            remainder += remainder_step;
+            if (remainder >= denominator) {
+                remainder -= denominator;
+                ++run_end;
             }
-            d += incNE; // 更新决策变量
-        } else {
-            d += incE; // 更新决策变量
         }
+    };
 
-        if (is_steep) {
-            y += y_step;
+    if (PixelBuffer* buffer = target.AsPixelBuffer(std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1))) {
+        // 游程平均短于 kMinRunLength 时逐像素写内存更快，像素相同
+        if (dx < kMinRunLength * dy) {
+            BufferPlot<true> plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+            RasterizeLine(x0, y0, x1, y1, plot, first, last);
         } else {
-            x += x_step;
+            BufferRunPlot plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+            rasterize(plot);
         }
-
-        draw_list->AddRect(ImVec2(x, y), ImVec2(x + 5, y + 5), color);
+        return;
     }
+
+    target.Reserve(last_run - first_run + 1);
+    TargetRunPlot plot { target, color };
+    rasterize(plot);
+}
+
+void DrawLineMidpointRunSlice(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color)
+{
+    DrawLineRunSlice(target, static_cast<int>(start.x), static_cast<int>(start.y),
+        static_cast<int>(end.x), static_cast<int>(end.y), color);
+}
+
+void DrawLineMidpointRunSlice(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius,
+    PixelStyle style)
+{
+    DrawListTarget target(draw_list, ImVec2(0.0f, 0.0f), radius, style);
+    DrawLineMidpointRunSlice(target, start, end, color);
+}
+
+void DrawLineBresenhamRunSlice(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color)
+{
+    DrawLineRunSlice(target, static_cast<int>(start.x), static_cast<int>(start.y),
+        static_cast<int>(end.x), static_cast<int>(end.y), color);
+}
+
+void DrawLineBresenhamRunSlice(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius,
+    PixelStyle style)
+{
+    DrawListTarget target(draw_list, ImVec2(0.0f, 0.0f), radius, style);
+    DrawLineBresenhamRunSlice(target, start, end, color);
 }
 
 // 使用中点画圆算法绘制圆
-void DrawCircleMidpoint(ImDrawList* draw_list,
+void DrawCircleMidpoint(RasterTarget& target,
     ImVec2 center,
     int radius,
     ImU32 color)
 {
+    int cx = static_cast<int>(std::floor(center.x + 0.5f));
+    int cy = static_cast<int>(std::floor(center.y + 0.5f));
+
     int x = 0;
     int y = radius;
     int d = 1 - radius; // 决策变量
 
+    // 每一步 8 个对称点，共约 radius / sqrt(2) 步
+    target.Reserve(8 * (static_cast<int>(radius * 0.7072f) + 2));
+
     // 辅助函数：绘制八分对称点
     auto draw_symmetric_points = [&](int x, int y) {
-        draw_list->AddCircleFilled(
-            ImVec2(center.x + x, center.y + y), 1.0f, color); // 第一象限
-        draw_list->AddCircleFilled(
-            ImVec2(center.x - x, center.y + y), 1.0f, color); // 第二象限
-        draw_list->AddCircleFilled(
-            ImVec2(center.x + x, center.y - y), 1.0f, color); // 第四象限
-        draw_list->AddCircleFilled(
-            ImVec2(center.x - x, center.y - y), 1.0f, color); // 第三象限
-        draw_list->AddCircleFilled(
-            ImVec2(center.x + y, center.y + x), 1.0f, color); // 垂直对称（第一）
-        draw_list->AddCircleFilled(
-            ImVec2(center.x - y, center.y + x), 1.0f, color); // 垂直对称（第二）
-        draw_list->AddCircleFilled(
-            ImVec2(center.x + y, center.y - x), 1.0f, color); // 垂直对称（第四）
-        draw_list->AddCircleFilled(
-            ImVec2(center.x - y, center.y - x), 1.0f, color); // 垂直对称（第三）
+        target.Plot(cx + x, cy + y, color); // 第一象限
+        target.Plot(cx - x, cy + y, color); // 第二象限
+        target.Plot(cx + x, cy - y, color); // 第四象限
+        target.Plot(cx - x, cy - y, color); // 第三象限
+        target.Plot(cx + y, cy + x, color); // 垂直对称（第一）
+        target.Plot(cx - y, cy + x, color); // 垂直对称（第二）
+        target.Plot(cx + y, cy - x, color); // 垂直对称（第四）
+        target.Plot(cx - y, cy - x, color); // 垂直对称（第三）
     };
 
     // 绘制初始点
@@ -199,13 +564,26 @@ void DrawCircleMidpoint(ImDrawList* draw_list,
     }
 }
 
+void DrawCircleMidpoint(ImDrawList* draw_list,
+    ImVec2 center,
+    int radius,
+    ImU32 color)
+{
+    // 以圆心为原点，保留圆心的亚像素位置
+    DrawListTarget target(draw_list, center, 1.0f);
+    DrawCircleMidpoint(target, ImVec2(0.0f, 0.0f), radius, color);
+}
+
 // 使用中点画椭圆算法绘制椭圆
-void DrawEllipseMidpoint(ImDrawList* draw_list,
+void DrawEllipseMidpoint(RasterTarget& target,
     ImVec2 center,
     int a,
     int b,
     ImU32 color)
 {
+    int cx = static_cast<int>(std::floor(center.x + 0.5f));
+    int cy = static_cast<int>(std::floor(center.y + 0.5f));
+
     int x = 0;
     int y = b;
 
@@ -214,12 +592,15 @@ void DrawEllipseMidpoint(ImDrawList* draw_list,
     int dx = 2 * b * b * x;
     int dy = 2 * a * a * y;
 
+    // 每一步 4 个对称点，两个区域合计不超过 a + b 步
+    target.Reserve(4 * (a + b + 2));
+
     // 辅助函数：绘制四象限对称点
     auto draw_symmetric_points = [&](int x, int y) {
-        draw_list->AddCircleFilled(ImVec2(center.x + x, center.y + y), 1.0f, color);
-        draw_list->AddCircleFilled(ImVec2(center.x - x, center.y + y), 1.0f, color);
-        draw_list->AddCircleFilled(ImVec2(center.x + x, center.y - y), 1.0f, color);
-        draw_list->AddCircleFilled(ImVec2(center.x - x, center.y - y), 1.0f, color);
+        target.Plot(cx + x, cy + y, color);
+        target.Plot(cx - x, cy + y, color);
+        target.Plot(cx + x, cy - y, color);
+        target.Plot(cx - x, cy - y, color);
     };
 
     // 绘制初始点
@@ -242,7 +623,8 @@ void DrawEllipseMidpoint(ImDrawList* draw_list,
     }
 
     // 第二区域
-    double d2 = b * b * (x + 0.5) * (x + 0.5) + a * a * (y - 1) * (y - 1) - a * a * b * b;
+    // (y - 1) 和 a * b 的平方在半轴较大时会超出 int，用 double 计算
+    double d2 = b * b * (x + 0.5) * (x + 0.5) + a * a * (y - 1.0) * (y - 1.0) - static_cast<double>(a) * a * b * b;
     while (y >= 0) {
         if (d2 > 0) {
             y--;
@@ -259,277 +641,246 @@ void DrawEllipseMidpoint(ImDrawList* draw_list,
     }
 }
 
-void DrawPolygon(ImDrawList* draw_list, const ImVec2& canvas_pos, const std::vector<ImVec2>& polygon, ImU32 color) {
-    for (size_t i = 0; i < polygon.size(); ++i) {
-        size_t next = (i + 1) % polygon.size();
-        draw_list->AddLine(
-            ImVec2(canvas_pos.x + polygon[i].x, canvas_pos.y + polygon[i].y),
-            ImVec2(canvas_pos.x + polygon[next].x, canvas_pos.y + polygon[next].y),
-            color, 2.0f
-        );
-    }
+void DrawEllipseMidpoint(ImDrawList* draw_list,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color)
+{
+    // 以椭圆中心为原点，保留中心的亚像素位置
+    DrawListTarget target(draw_list, center, 1.0f);
+    DrawEllipseMidpoint(target, ImVec2(0.0f, 0.0f), a, b, color);
 }
 
-// 使用有序边表算法绘制填充多边形
-// 边结构体
-void DrawPolygonWithOrderedEdgeTable(ImDrawList* draw_list,
-    ImVec2 canvas_pos,
-    const std::vector<float>& x,
-    const std::vector<float>& y,
-    int vertexCount,
+// 实心圆：与 DrawCircleMidpoint 相同的决策变量，但每条扫描线只输出一段水平像素
+// 每行的范围就是该行轮廓像素的最左到最右，共 2 * radius + 1 段
+void DrawCircleFilledMidpoint(RasterTarget& target,
+    ImVec2 center,
+    int radius,
     ImU32 color)
 {
-    if (vertexCount < 3)
-        return; // 至少需要 3 个顶点
-
-    // 首先找到多边形的y范围
-    int ymin = std::numeric_limits<int>::max();
-    int ymax = std::numeric_limits<int>::min();
+    int cx = static_cast<int>(std::floor(center.x + 0.5f));
+    int cy = static_cast<int>(std::floor(center.y + 0.5f));
 
-    for (int i = 0; i < vertexCount; ++i) {
-        ymin = std::min(ymin, static_cast<int>(std::floor(y[i])));
-        ymax = std::max(ymax, static_cast<int>(std::ceil(y[i])));
-    }
-
-    // 创建边表，根据y范围动态调整大小
-    std::vector<std::vector<Edge>> edgeTable(ymax - ymin + 1);
-
-    for (int i = 0; i < vertexCount; ++i) {
-        int next = (i + 1) % vertexCount;
-        float x0f = x[i];
-        float y0f = y[i];
-        float x1f = x[next];
-        float y1f = y[next];
-
-        // 忽略水平边
-        if (y0f == y1f)
-            continue;
-
-        // 确保 y0 < y1
-        if (y0f > y1f) {
-            std::swap(x0f, x1f);
-            std::swap(y0f, y1f);
-        }
-
-        // 计算边的增量
-        float dx = (x1f - x0f) / (y1f - y0f);
-
-        // 根据扫描线规则处理顶点共享情况
-        // 如果顶点是局部最小或最大，只包含一次
-        if (std::ceil(y0f) == std::floor(y1f)) {
-            y1f -= 1.0f; // 让上端点不包含在当前边
-        }
-        // Edge(float x_val, float dx_val, int ymax_val): x(x_val), dx(dx_val),
-        // ymax(ymax_val) {}
-        Edge edge;
-        edge.x = x0f;
-        edge.dx = dx;
-        edge.ymax = static_cast<int>(std::ceil(y1f));
-
-        // 将边添加到对应的边表
-        int edgeTableIndex = static_cast<int>(std::floor(y0f)) - ymin;
-        if (edgeTableIndex >= 0 && edgeTableIndex < edgeTable.size()) {
-            edgeTable[edgeTableIndex].push_back(edge);
-        }
-    }
+    int x = 0;
+    int y = radius;
+    int d = 1 - radius; // 决策变量
 
-    // 初始化活动边表 (Active Edge Table, AET)
-    std::vector<Edge> activeEdgeTable;
+    target.Reserve(2 * radius + 1);
 
-    // 扫描线填充
-    for (int y = ymin; y <= ymax; ++y) {
-        int scanLine = y;
+    // 辅助函数：以圆心为轴上下对称的两行
+    auto fill_rows = [&](int row, int half_width) {
+        target.PlotSpan(cx - half_width, cx + half_width, cy + row, color);
+        if (row != 0)
+            target.PlotSpan(cx - half_width, cx + half_width, cy - row, color);
+    };
 
-        // 将当前扫描线的边加入 AET
-        if (scanLine - ymin >= 0 && scanLine - ymin < edgeTable.size()) {
-            activeEdgeTable.insert(activeEdgeTable.end(),
-                edgeTable[scanLine - ymin].begin(),
-                edgeTable[scanLine - ymin].end());
-        }
+    // 第 x 行的半宽为 y（靠近水平直径的部分）
+    fill_rows(x, y);
 
-        // 移除 y >= ymax 的边
-        activeEdgeTable.erase(
-            std::remove_if(activeEdgeTable.begin(),
-                activeEdgeTable.end(),
-                [scanLine](const Edge& e) { return e.ymax <= scanLine; }),
-            activeEdgeTable.end());
-
-        // 按 x 排序 AET
-        std::sort(activeEdgeTable.begin(),
-            activeEdgeTable.end(),
-            [](const Edge& a, const Edge& b) -> bool { return a.x < b.x; });
-
-        // 使用偶数奇数规则绘制扫描线
-        for (size_t i = 0; i + 1 < activeEdgeTable.size(); i += 2) {
-            float xStart = activeEdgeTable[i].x;
-            float xEnd = activeEdgeTable[i + 1].x;
-
-            // 转换为整数像素坐标，考虑画布偏���
-            int pixelStart = static_cast<int>(std::ceil(xStart));
-            int pixelEnd = static_cast<int>(std::floor(xEnd));
-
-            if (pixelEnd >= pixelStart) {
-                draw_list->AddLine(
-                    ImVec2(canvas_pos.x + pixelStart, canvas_pos.y + scanLine),
-                    ImVec2(canvas_pos.x + pixelEnd, canvas_pos.y + scanLine),
-                    color);
-            }
+    while (x < y) {
+        int prev_x = x;
+        int prev_y = y;
+        if (d < 0) { // 选择右侧点
+            d += 2 * x + 3;
+        } else { // 选择右下方点
+            d += 2 * (x - y) + 5;
+            y--;
         }
+        x++;
 
-        // 更新 AET 中每条边的 x
-        for (auto& edge : activeEdgeTable) {
-            edge.x += edge.dx;
-        }
+        // 第 prev_y 行已经走完，半宽为该行最右的 prev_x；
+        // 若 x 会走到这一行，它由下面按 x 输出的行负责
+        if (y != prev_y && prev_y > x)
+            fill_rows(prev_y, prev_x);
+        fill_rows(x, y);
     }
 }
 
-// 使用边标志法（Edge Flag Method）绘制填充多边形
-// 使用边标志法（Edge Flag Method）绘制填充多边形
-void DrawPolygonWithEdgeFlagMethod(ImDrawList* draw_list,
-    ImVec2 canvas_pos,
-    const std::vector<float>& x,
-    const std::vector<float>& y,
-    int vertexCount,
+void DrawCircleFilledMidpoint(ImDrawList* draw_list,
+    ImVec2 center,
+    int radius,
     ImU32 color)
 {
-    if (vertexCount < 3)
-        return; // 多边形至少需要3个顶点
-
-    // 1. 确定多边形的y范围
-    int ymin = std::numeric_limits<int>::max();
-    int ymax = std::numeric_limits<int>::min();
-
-    for (int i = 0; i < vertexCount; ++i) {
-        ymin = std::min(ymin, static_cast<int>(std::floor(y[i])));
-        ymax = std::max(ymax, static_cast<int>(std::ceil(y[i])));
-    }
+    // 每段是一个恰好覆盖像素格的四边形
+    DrawListTarget target(draw_list, center, 0.5f, PIXEL_QUAD);
+    DrawCircleFilledMidpoint(target, ImVec2(0.0f, 0.0f), radius, color);
+}
 
-    // 2. 创建边表，根据y范围动态调整大小
-    std::vector<std::vector<Edge>> edgeTable(ymax - ymin + 1);
+// 实心椭圆：与 DrawEllipseMidpoint 相同的两区域决策变量，每条扫描线只输出一段水平像素
+// 中间量用 64 位和 double 计算，避免大半轴时溢出
+void DrawEllipseFilledMidpoint(RasterTarget& target,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color)
+{
+    int cx = static_cast<int>(std::floor(center.x + 0.5f));
+    int cy = static_cast<int>(std::floor(center.y + 0.5f));
 
-    for (int i = 0; i < vertexCount; ++i) {
-        int next = (i + 1) % vertexCount;
-        float x0f = x[i];
-        float y0f = y[i];
-        float x1f = x[next];
-        float y1f = y[next];
+    const long long a2 = static_cast<long long>(a) * a;
+    const long long b2 = static_cast<long long>(b) * b;
 
-        // 忽略水平边
-        if (y0f == y1f)
-            continue;
+    int x = 0;
+    int y = b;
 
-        // 确保 y0 < y1
-        if (y0f > y1f) {
-            std::swap(x0f, x1f);
-            std::swap(y0f, y1f);
+    // 决策变量
+    double d1 = b2 - a2 * b + 0.25 * a2;
+    long long dx = 2 * b2 * x;
+    long long dy = 2 * a2 * y;
+
+    target.Reserve(2 * b + 1);
+
+    // 当前行及其最右像素，换行时才输出上一行
+    int row = y;
+    int row_half_width = x;
+    auto fill_rows = [&](int r, int half_width) {
+        target.PlotSpan(cx - half_width, cx + half_width, cy + r, color);
+        if (r != 0)
+            target.PlotSpan(cx - half_width, cx + half_width, cy - r, color);
+    };
+    auto visit = [&](int px, int py) {
+        if (py != row) {
+            fill_rows(row, row_half_width);
+            row = py;
         }
+        row_half_width = px;
+    };
 
-        // 计算边的增量
-        float dx = (x1f - x0f) / (y1f - y0f);
-
-        // 根据扫描线规则处理顶点共享情况
-        // 如果顶点是局部最小或最大，只包含一次
-        if (std::ceil(y0f) == std::floor(y1f)) {
-            y1f -= 1.0f; // 让上端点不包含在当前边
+    // 第一区域
+    while (dx < dy) {
+        if (d1 < 0) {
+            x++;
+            dx += 2 * b2;
+            d1 += dx + b2;
+        } else {
+            x++;
+            y--;
+            dx += 2 * b2;
+            dy -= 2 * a2;
+            d1 += dx - dy + b2;
         }
+        visit(x, y);
+    }
 
-        Edge edge;
-        edge.x = x0f;
-        edge.dx = dx;
-        edge.ymax = static_cast<int>(std::ceil(y1f));
-
-        // 将边添加到对应的边表
-        int edgeTableIndex = static_cast<int>(std::floor(y0f)) - ymin;
-        if (edgeTableIndex >= 0 && edgeTableIndex < edgeTable.size()) {
-            edgeTable[edgeTableIndex].push_back(edge);
+    // 第二区域：每步下移一行，走到 x 轴为止
+    double d2 = b2 * (x + 0.5) * (x + 0.5) + a2 * (y - 1.0) * (y - 1.0) - static_cast<double>(a2) * b2;
+    while (y > 0) {
+        if (d2 > 0) {
+            y--;
+            dy -= 2 * a2;
+            d2 += a2 - dy;
+        } else {
+            x++;
+            y--;
+            dx += 2 * b2;
+            dy -= 2 * a2;
+            d2 += dx - dy + a2;
         }
+        visit(x, y);
     }
+    fill_rows(row, row_half_width);
+}
 
-    // 3. 初始化活动边表 (Active Edge Table, AET)
-    std::vector<Edge> activeEdgeTable;
-
-    // 4. 扫描线填充
-    for (int y = ymin; y <= ymax; ++y) {
-        int scanLine = y;
+void DrawEllipseFilledMidpoint(ImDrawList* draw_list,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color)
+{
+    DrawListTarget target(draw_list, center, 0.5f, PIXEL_QUAD);
+    DrawEllipseFilledMidpoint(target, ImVec2(0.0f, 0.0f), a, b, color);
+}
 
-        // 将当前扫描线的边加入 AET
-        if (scanLine - ymin >= 0 && scanLine - ymin < edgeTable.size()) {
-            activeEdgeTable.insert(activeEdgeTable.end(),
-                edgeTable[scanLine - ymin].begin(),
-                edgeTable[scanLine - ymin].end());
-        }
+void DrawPolygon(ImDrawList* draw_list, const ImVec2& canvas_pos, const std::vector<ImVec2>& polygon, ImU32 color) {
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        size_t next = (i + 1) % polygon.size();
+        draw_list->AddLine(
+            ImVec2(canvas_pos.x + polygon[i].x, canvas_pos.y + polygon[i].y),
+            ImVec2(canvas_pos.x + polygon[next].x, canvas_pos.y + polygon[next].y),
+            color, 2.0f
+        );
+    }
+}
 
-        // 移除 y >= ymax 的边
-        activeEdgeTable.erase(
-            std::remove_if(activeEdgeTable.begin(),
-                activeEdgeTable.end(),
-                [scanLine](const Edge& e) { return e.ymax <= scanLine; }),
-            activeEdgeTable.end());
-
-        // 按 x 排序 AET
-        std::sort(activeEdgeTable.begin(),
-            activeEdgeTable.end(),
-            [](const Edge& a, const Edge& b) -> bool { return a.x < b.x; });
-
-        // 使用边标志法（Edge Flag Method）进行填充
-        bool fill = false;
-        float xStart = 0.0f, xEnd = 0.0f;
-
-        for (size_t i = 0; i < activeEdgeTable.size(); ++i) {
-            if (!fill) {
-                xStart = activeEdgeTable[i].x;
-                fill = true;
-            } else {
-                xEnd = activeEdgeTable[i].x;
-                // 绘制从 xStart 到 xEnd 的线
-                draw_list->AddLine(
-                    ImVec2(canvas_pos.x + xStart, canvas_pos.y + scanLine),
-                    ImVec2(canvas_pos.x + xEnd, canvas_pos.y + scanLine),
-                    color);
-                fill = false;
-            }
-        }
+// 使用有序边表算法绘制填充多边形
+// 边结构体
+void DrawPolygonWithOrderedEdgeTable(RasterTarget& target,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color)
+{
+    // 边表和活动边表的缓冲按线程复用
+    static thread_local ScanlineScratch scratch;
+    FillPolygonScanline(target, x.data(), y.data(), vertexCount, color, scratch);
+}
 
-        // 更新 AET 中每条边的 x
-        for (auto& edge : activeEdgeTable) {
-            edge.x += edge.dx;
-        }
-    }
+void DrawPolygonWithOrderedEdgeTable(ImDrawList* draw_list,
+    ImVec2 canvas_pos,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color)
+{
+    // 每段是一个恰好覆盖像素格的四边形
+    DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+    DrawPolygonWithOrderedEdgeTable(target, x, y, vertexCount, color);
 }
 
-// 填充多边形区域（修复偏移问题）
-void DrawFilledRegion(ImDrawList* draw_list, ImVec2 canvas_pos, ImVec2 canvas_size, const std::vector<ImVec2>& vertices, int vertex_count, ImVec2 seed_point, ImU32 fill_color) {
-    // 创建一个临时数组，用于存储转换后的顶点坐标
-    std::vector<ImVec2> screen_vertices;
-    screen_vertices.reserve(vertex_count);
+// 使用边标志法（Edge Flag Method）绘制填充多边形
+void DrawPolygonWithEdgeFlagMethod(RasterTarget& target,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color)
+{
+    // 标志缓冲按线程复用
+    static thread_local EdgeFlagScratch scratch;
+    FillPolygonEdgeFlag(target, x.data(), y.data(), vertexCount, color, scratch);
+}
 
-    // 将顶点坐标从多边形坐标系转换为屏幕坐标
-    for (int i = 0; i < vertex_count; ++i) {
-        screen_vertices.push_back(ImVec2(canvas_pos.x + vertices[i].x, canvas_pos.y + vertices[i].y));
-    }
+void DrawPolygonWithEdgeFlagMethod(ImDrawList* draw_list,
+    ImVec2 canvas_pos,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color)
+{
+    // 每段是一个恰好覆盖像素格的四边形
+    DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+    DrawPolygonWithEdgeFlagMethod(target, x, y, vertexCount, color);
+}
 
-    // 判断种子点是否在多边形内（射线法）
-    bool inside_polygon = false;
-    int intersections = 0;
+// 种子填充多边形区域：把多边形的边界画进掩码，再从种子点做扫描线种子填充
+// 填充的是种子所在的连通区域，种子在多边形外部时填充的是画布上的外部区域
+void DrawFilledRegion(ImDrawList* draw_list, ImVec2 canvas_pos, ImVec2 canvas_size, const std::vector<ImVec2>& vertices, int vertex_count, ImVec2 seed_point, ImU32 fill_color)
+{
+    // 掩码和段栈按线程复用
+    static thread_local BoundaryMask mask;
+    static thread_local SeedFillScratch scratch;
+
+    int width = static_cast<int>(canvas_size.x);
+    int height = static_cast<int>(canvas_size.y);
+    if (width <= 0 || height <= 0 || vertex_count < 2)
+        return;
+    if (mask.width != width || mask.height != height)
+        mask.Resize(width, height);
+    else
+        mask.Clear();
+
+    // Bresenham 画出的边界是 8 连通的，4 连通的种子填充不会从斜线的缝隙漏出去
     for (int i = 0; i < vertex_count; ++i) {
-        ImVec2 p1 = vertices[i];
-        ImVec2 p2 = vertices[(i + 1) % vertex_count];
-        if ((seed_point.y > p1.y) != (seed_point.y > p2.y)) {
-            float x_intersect = p1.x + (seed_point.y - p1.y) * (p2.x - p1.x) / (p2.y - p1.y);
-            if (seed_point.x < x_intersect) {
-                intersections++;
-            }
-        }
+        const ImVec2& a = vertices[i];
+        const ImVec2& b = vertices[(i + 1) % vertex_count];
+        DrawLineBresenham(mask, a, b, IM_COL32_WHITE);
     }
-    inside_polygon = (intersections % 2 == 1);
 
-    // 如果种子点在多边形内部，则填充内部
-    if (inside_polygon) {
-        draw_list->AddConvexPolyFilled(screen_vertices.data(), vertex_count, fill_color);
-    }
+    // 每个像素一个 1x1 的四边形，覆盖 [x, x + 1) x [y, y + 1)；一段只生成一个四边形
+    DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+    SeedFillBoundaryMask(target, mask, static_cast<int>(seed_point.x), static_cast<int>(seed_point.y), fill_color, scratch);
 }
 
-
 // 计算点的区域码
 OutCode ComputeOutCode(float x, float y, float xmin, float ymin, float xmax, float ymax)
 {
@@ -615,59 +966,12 @@ bool IsInside(const ImVec2& point, const ClipWindow& clipWindow, int edge) {
     return false;
 }
 
-// 计算交点
-ImVec2 ComputeIntersection(const ImVec2& p1, const ImVec2& p2, const ClipWindow& clipWindow, int edge) {
-    float x, y;
-
-    switch (edge) {
-    case 0: // 左边界
-        x = clipWindow.x0;
-        y = p1.y + (p2.y - p1.y) * (clipWindow.x0 - p1.x) / (p2.x - p1.x);
-        break;
-    case 1: // 右边界
-        x = clipWindow.x1;
-        y = p1.y + (p2.y - p1.y) * (clipWindow.x1 - p1.x) / (p2.x - p1.x);
-        break;
-    case 2: // 下边界
-        y = clipWindow.y0;
-        x = p1.x + (p2.x - p1.x) * (clipWindow.y0 - p1.y) / (p2.y - p1.y);
-        break;
-    case 3: // 上边界
-        y = clipWindow.y1;
-        x = p1.x + (p2.x - p1.x) * (clipWindow.y1 - p1.y) / (p2.y - p1.y);
-        break;
-    }
-
-    return ImVec2(x, y);
-}
-
 // Sutherland-Hodgman 多边形裁剪算法
 std::vector<ImVec2> SutherlandHodgmanPolygonClip(const std::vector<ImVec2>& polygon, const ClipWindow& clipWindow) {
-    std::vector<ImVec2> inputList = polygon;
+    // 中间结果的缓冲按线程复用
+    static thread_local PolygonClipScratch scratch;
     std::vector<ImVec2> outputList;
-
-    for (int edge = 0; edge < 4; ++edge) { // 对每条裁剪边进行裁剪
-        outputList.clear();
-
-        ImVec2 prevPoint = inputList.back(); // 多边形最后一个点
-        for (const auto& curPoint : inputList) {
-            if (IsInside(curPoint, clipWindow, edge)) { // 当前点在裁剪窗口内
-                if (!IsInside(prevPoint, clipWindow, edge)) {
-                    // 上一个点在裁剪窗口外，计算交点
-                    outputList.push_back(ComputeIntersection(prevPoint, curPoint, clipWindow, edge));
-                }
-                // 添加当前点
-                outputList.push_back(curPoint);
-            } else if (IsInside(prevPoint, clipWindow, edge)) {
-                // 当前点在裁剪窗口外，上一个点在窗口内，计算交点
-                outputList.push_back(ComputeIntersection(prevPoint, curPoint, clipWindow, edge));
-            }
-            prevPoint = curPoint;
-        }
-
-        inputList = outputList; // 更新输入点集
-    }
-
+    ClipPolygonSutherlandHodgman(polygon.data(), static_cast<int>(polygon.size()), clipWindow, outputList, scratch);
     return outputList;
 }
 
@@ -700,161 +1004,21 @@ bool IsIntersect(
     return true;
 }
 
-// Weiler-Atherton 多边形裁剪���法实现
+// Weiler-Atherton 多边形裁剪算法实现
 std::vector<std::vector<ImVec2>> WeilerAthertonPolygonClip(
     const std::vector<ImVec2>& subjectPolygon,
     const std::vector<ImVec2>& clipPolygon) 
 {
-    // 复制原始多边形以插入交点
-    std::vector<ImVec2> subject = subjectPolygon;
-    std::vector<ImVec2> clip = clipPolygon;
-
-    // 存储交点信息
-    std::vector<IntersectionPoint> subjectIntersections;
-    std::vector<IntersectionPoint> clipIntersections;
-
-    // 查找并插入交点
-    for (size_t i = 0; i < subject.size(); ++i) {
-        size_t next_i = (i + 1) % subject.size();
-        ImVec2 A = subject[i];
-        ImVec2 B = subject[next_i];
-        for (size_t j = 0; j < clip.size(); ++j) {
-            size_t next_j = (j + 1) % clip.size();
-            ImVec2 C = clip[j];
-            ImVec2 D = clip[next_j];
-            ImVec2 intersection;
-            float t;
-            if (IsIntersect(A, B, C, D, intersection, t)) {
-                // 插入交点到 subject 多边形
-                subject.insert(subject.begin() + i + 1, intersection);
-                subjectIntersections.emplace_back(intersection, false); // 初始未标记
-                ++i; // 跳过刚插入的交点
-
-                // 插入交点到 clip 多边形
-                clip.insert(clip.begin() + j + 1, intersection);
-                clipIntersections.emplace_back(intersection, false);
-                ++j; // 跳过刚插入的交点
-            }
-        }
-    }
-
-    // 如果没有交点，返回空结果或根据情况返回完整主多边形
-    if (subjectIntersections.empty()) {
-        // 检查是否完全 inside
-        // 简单判断第一个点是否在裁剪窗口内
-        // 可以使用射线法或其他方法
-        // 这里假设使用 Sutherland-Hodgman 内部判断
-        // 为简化，此处返回空
-        return {};
-    }
-
-    // 标记交点为入口或出口
-    // 假设裁剪多边形是逆时针排列
-    for (auto& inter : subjectIntersections) {
-        // 找出当前交点在 subject 和 clip 中的位置
-        size_t subj_idx = std::distance(subject.begin(),
-            std::find(subject.begin(), subject.end(), inter.point));
-        size_t clip_idx = std::distance(clip.begin(),
-            std::find(clip.begin(), clip.end(), inter.point));
-
-        // 获取前一个点和后一个点
-        ImVec2 prev = (subj_idx == 0) ? subject.back() : subject[subj_idx - 1];
-        ImVec2 next = (subj_idx + 1 < subject.size()) ? subject[subj_idx + 1] : subject[0];
-
-        // 计算向量 AB 和 BC 的叉积
-        ImVec2 AB = ImVec2(next.x - inter.point.x, next.y - inter.point.y);
-        ImVec2 BC = ImVec2(clip[(clip_idx + 1) % clip.size()].x - inter.point.x,
-                           clip[(clip_idx + 1) % clip.size()].y - inter.point.y);
-        float cross = AB.x * BC.y - AB.y * BC.x;
-
-        // 如果叉积 > 0，则是进入
-        inter.isEntering = (cross > 0);
-    }
-
-    // 遍历交点，构建裁剪后的多边形
-    std::vector<std::vector<ImVec2>> resultPolygons;
-
-    for (auto& startInter : subjectIntersections) {
-        if (startInter.visited || !startInter.isEntering)
-            continue;
-
-        std::vector<ImVec2> clippedPolygon;
-        IntersectionPoint* currentInter = &startInter;
-        bool traverseSubject = true;
-
-        while (currentInter != nullptr) {
-            if (currentInter->visited)
-                break;
-
-            currentInter->visited = true;
-            clippedPolygon.emplace_back(currentInter->point);
-
-            if (traverseSubject) {
-                // 从当前交点开始，遍历 subject 多边形
-                size_t subj_idx = std::distance(subject.begin(),
-                    std::find(subject.begin(), subject.end(), currentInter->point));
-                size_t next_subj_idx = (subj_idx + 1) % subject.size();
-
-                while (next_subj_idx != subj_idx) {
-                    ImVec2 currentPoint = subject[next_subj_idx];
-                    clippedPolygon.emplace_back(currentPoint);
-
-                    // 检查是否是另一个交点
-                    auto it = std::find_if(subjectIntersections.begin(),
-                        subjectIntersections.end(),
-                        [&](const IntersectionPoint& ip) {
-                            return ip.point.x == currentPoint.x && ip.point.y == currentPoint.y;
-                        });
-
-                    if (it != subjectIntersections.end()) {
-                        currentInter = &(*it);
-                        traverseSubject = false;
-                        break;
-                    }
-
-                    next_subj_idx = (next_subj_idx + 1) % subject.size();
-                }
-
-                if (next_subj_idx == subj_idx) {
-                    currentInter = nullptr;
-                }
-            }
-            else {
-                // 从当前交点开始，遍历 clip 多边形
-                size_t clip_idx = std::distance(clip.begin(),
-                    std::find(clip.begin(), clip.end(), currentInter->point));
-                size_t next_clip_idx = (clip_idx + 1) % clip.size();
-
-                while (next_clip_idx != clip_idx) {
-                    ImVec2 currentPoint = clip[next_clip_idx];
-                    clippedPolygon.emplace_back(currentPoint);
-
-                    // 检查是否是另一个交点
-                    auto it = std::find_if(clipIntersections.begin(),
-                        clipIntersections.end(),
-                        [&](const IntersectionPoint& ip) {
-                            return ip.point.x == currentPoint.x && ip.point.y == currentPoint.y;
-                        });
-
-                    if (it != clipIntersections.end()) {
-                        currentInter = &(*it);
-                        traverseSubject = true;
-                        break;
-                    }
-
-                    next_clip_idx = (next_clip_idx + 1) % clip.size();
-                }
-
-                if (next_clip_idx == clip_idx) {
-                    currentInter = nullptr;
-                }
-            }
-        }
-
-        if (clippedPolygon.size() >= 3)
-            resultPolygons.push_back(clippedPolygon);
-    }
-
+    // 顶点图和求交的缓冲按线程复用
+    static thread_local WeilerAthertonScratch scratch;
+    static thread_local std::vector<ImVec2> points;
+    static thread_local std::vector<int> start;
+    int count = ClipPolygonWeilerAtherton(subjectPolygon.data(), static_cast<int>(subjectPolygon.size()),
+        clipPolygon.data(), static_cast<int>(clipPolygon.size()), points, start, scratch);
+
+    std::vector<std::vector<ImVec2>> resultPolygons(count);
+    for (int i = 0; i < count; ++i)
+        resultPolygons[i].assign(points.begin() + start[i], points.begin() + start[i + 1]);
     return resultPolygons;
 }
 
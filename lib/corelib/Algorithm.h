@@ -2,6 +2,7 @@
 #define ALGORITHM_H
 
 #include "imgui.h"
+#include "RasterTarget.h"
 #include <vector>
 #include <cmath>
 #include <algorithm>
@@ -54,41 +55,173 @@ struct Edge {
     int ymax; // 边的上限扫描线 y 坐标
 };
 
+// 以下绘制函数都有两个版本：
+// RasterTarget 版本把像素输出到任意目标（例如 CPU 帧缓冲），不需要 OpenGL 上下文；
+// ImDrawList 版本只是以 DrawListTarget 作为输出目标的简单封装
+
+// DDA 的步进状态：第 first 步的坐标 (x, y)、每步的增量，以及要走的步数范围 [first, last]
+struct LineDDASetup {
+    float x, y;
+    float x_inc, y_inc;
+    int first, last;
+};
+
+// 求 DrawLineDDA 的步进状态，只保留可能落在 target 可见范围内的步（target 为 nullptr 时不裁剪）
+// 没有可见像素或端点不是有限值时返回 false；步数超出 int 范围的部分截断
+// 批量 DDA 也用它装入线段，所以两者逐像素相同
+bool SetupLineDDA(const RasterTarget* target, ImVec2 start, ImVec2 end, LineDDASetup& dda);
+
 // 使用 DDA 算法绘制直线
+void DrawLineDDA(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color);
+
 void DrawLineDDA(ImDrawList* draw_list,
     ImVec2 start,
     ImVec2 end,
     ImU32 color,
-    float radius = 1.0f);
+    float radius = 1.0f,
+    PixelStyle style = PIXEL_CIRCLE);
+
+// 32.32 定点 DDA：内层循环只有整数加法，两端点精确命中，结果与编译器和浮点选项无关
+// 端点先四舍五入到整数像素；整数版本支持整个 int 范围的坐标（超过 float 能精确表示的 2^24）
+void DrawLineDDAFixed(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color);
+
+void DrawLineDDAFixed(RasterTarget& target,
+    int x0,
+    int y0,
+    int x1,
+    int y1,
+    ImU32 color);
+
+void DrawLineDDAFixed(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius = 1.0f,
+    PixelStyle style = PIXEL_CIRCLE);
 
 // 使用中点算法绘制直线
+void DrawLineMidpoint(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color);
+
 void DrawLineMidpoint(ImDrawList* draw_list,
     ImVec2 start,
     ImVec2 end,
     ImU32 color,
-    float radius = 1.0f);
+    float radius = 1.0f,
+    PixelStyle style = PIXEL_CIRCLE);
+
+// 只收集像素坐标，追加到 pixels 末尾
+void DrawLineMidpoint(std::vector<PixelCoord>& pixels,
+    ImVec2 start,
+    ImVec2 end);
 
 // 使用 Bresenham 算法绘制直线
+void DrawLineBresenham(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color);
+
 void DrawLineBresenham(ImDrawList* draw_list,
     ImVec2 start,
     ImVec2 end,
     ImU32 color,
-    float radius = 1.0f);
+    float radius = 1.0f,
+    PixelStyle style = PIXEL_CIRCLE);
+
+// 只收集像素坐标，追加到 pixels 末尾
+void DrawLineBresenham(std::vector<PixelCoord>& pixels,
+    ImVec2 start,
+    ImVec2 end);
+
+// 游程（run-slice）版本：像素集合与上面的逐像素版本完全相同，
+// 但每一段连续的水平/竖直像素只输出一个 PlotSpan / PlotVSpan（一个四边形）
+void DrawLineMidpointRunSlice(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color);
+
+void DrawLineMidpointRunSlice(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius = 1.0f,
+    PixelStyle style = PIXEL_QUAD);
+
+void DrawLineBresenhamRunSlice(RasterTarget& target,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color);
+
+void DrawLineBresenhamRunSlice(ImDrawList* draw_list,
+    ImVec2 start,
+    ImVec2 end,
+    ImU32 color,
+    float radius = 1.0f,
+    PixelStyle style = PIXEL_QUAD);
+
+void DrawCircleMidpoint(RasterTarget& target,
+    ImVec2 center,
+    int radius,
+    ImU32 color);
 
 void DrawCircleMidpoint(ImDrawList* draw_list,
     ImVec2 center,
     int radius,
     ImU32 color);
 
+void DrawEllipseMidpoint(RasterTarget& target,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color);
+
 void DrawEllipseMidpoint(ImDrawList* draw_list,
     ImVec2 center,
     int a,
     int b,
     ImU32 color);
 
+// 实心圆和实心椭圆：与上面的轮廓版本走同样的决策变量，但每条扫描线只输出一段水平像素
+// 半径 500 的圆只需约 1000 段，而不是逐个绘制 78 万个像素
+void DrawCircleFilledMidpoint(RasterTarget& target,
+    ImVec2 center,
+    int radius,
+    ImU32 color);
+
+void DrawCircleFilledMidpoint(ImDrawList* draw_list,
+    ImVec2 center,
+    int radius,
+    ImU32 color);
+
+void DrawEllipseFilledMidpoint(RasterTarget& target,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color);
+
+void DrawEllipseFilledMidpoint(ImDrawList* draw_list,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color);
+
 void DrawPolygon(ImDrawList* draw_list, const ImVec2& canvas_pos, const std::vector<ImVec2>& polygon, ImU32 color);
 
-// 使用有序边表算法绘制填充多边形
+// 使用有序边表算法绘制填充多边形（RasterTarget 版本的顶点坐标即目标的像素坐标）
+void DrawPolygonWithOrderedEdgeTable(RasterTarget& target,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color);
+
 void DrawPolygonWithOrderedEdgeTable(ImDrawList* draw_list,
     ImVec2 canvas_pos,
     const std::vector<float>& x,
@@ -96,7 +229,14 @@ void DrawPolygonWithOrderedEdgeTable(ImDrawList* draw_list,
     int vertexCount,
     ImU32 color);
 
-// 使用边标志法（Edge Flag Method）绘制填充多边形
+// 使用边标志法（Edge Flag Method）绘制填充多边形：按位标记交点，再逐行前缀异或得到填充段
+// 采样规则与有序边表法不同，见 FillPolygonEdgeFlag
+void DrawPolygonWithEdgeFlagMethod(RasterTarget& target,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color);
+
 void DrawPolygonWithEdgeFlagMethod(ImDrawList* draw_list,
     ImVec2 canvas_pos,
     const std::vector<float>& x,
@@ -104,6 +244,7 @@ void DrawPolygonWithEdgeFlagMethod(ImDrawList* draw_list,
     int vertexCount,
     ImU32 color);
 
+// 扫描线种子填充：填充多边形边界内种子点所在的连通区域（边界按 Bresenham 光栅化，4 连通）
 void DrawFilledRegion(ImDrawList* draw_list, ImVec2 canvas_pos, ImVec2 canvas_size, const std::vector<ImVec2>& vertices, int vertex_count, ImVec2 seed_point, ImU32 fill_color);
 
 // 区域码定义
@@ -0,0 +1,227 @@
+#include "ConicOffsetCache.h"
+#include "Algorithm.h"
+#include "LineRasterizer.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+ConicOffsetCache::ConicOffsetCache(size_t capacity)
+    : capacity(capacity)
+    , hits(0)
+    , misses(0)
+    , bytes(0)
+{
+}
+
+void ConicOffsetCache::Clear()
+{
+    entries.clear();
+    lookup.clear();
+    bytes = 0;
+}
+
+bool ConicOffsetCache::Acquire(uint64_t key, std::vector<OffsetPair>*& offsets)
+{
+    auto it = lookup.find(key);
+    if (it != lookup.end()) {
+        hits++;
+        entries.splice(entries.begin(), entries, it->second);
+        offsets = &entries.front().offsets;
+        return true;
+    }
+
+    misses++;
+    // 淘汰最久未使用的条目
+    while (!entries.empty() && entries.size() >= std::max<size_t>(capacity, 1)) {
+        bytes -= entries.back().offsets.size() * sizeof(OffsetPair);
+        lookup.erase(entries.back().key);
+        entries.pop_back();
+    }
+    entries.push_front(Entry { key, {} });
+    lookup[key] = entries.begin();
+    offsets = &entries.front().offsets;
+    return false;
+}
+
+const std::vector<OffsetPair>& ConicOffsetCache::CircleOffsets(int radius)
+{
+    std::vector<OffsetPair>* offsets;
+    if (Acquire(static_cast<uint64_t>(radius), offsets))
+        return *offsets;
+
+    // 与 DrawCircleMidpoint 相同的决策变量
+    int x = 0;
+    int y = radius;
+    int d = 1 - radius;
+    offsets->reserve(static_cast<size_t>(radius * 0.7072f) + 2);
+    offsets->push_back(OffsetPair { static_cast<int16_t>(x), static_cast<int16_t>(y) });
+    while (x < y) {
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            y--;
+        }
+        x++;
+        offsets->push_back(OffsetPair { static_cast<int16_t>(x), static_cast<int16_t>(y) });
+    }
+    offsets->shrink_to_fit();
+    bytes += offsets->size() * sizeof(OffsetPair);
+    return *offsets;
+}
+
+const std::vector<OffsetPair>& ConicOffsetCache::EllipseOffsets(int a, int b)
+{
+    std::vector<OffsetPair>* offsets;
+    if (Acquire((1ULL << 63) | (static_cast<uint64_t>(a) << 32) | static_cast<uint64_t>(b), offsets))
+        return *offsets;
+
+    // 与 DrawEllipseMidpoint 相同的两区域决策变量（包括最后走到 y = -1 的一步）
+    int x = 0;
+    int y = b;
+    double d1 = b * b - a * a * b + 0.25 * a * a;
+    int dx = 2 * b * b * x;
+    int dy = 2 * a * a * y;
+    offsets->reserve(a + b + 2);
+    auto push = [&]() { offsets->push_back(OffsetPair { static_cast<int16_t>(x), static_cast<int16_t>(y) }); };
+
+    push();
+    while (dx < dy) {
+        if (d1 < 0) {
+            x++;
+            dx += 2 * b * b;
+            d1 += dx + b * b;
+        } else {
+            x++;
+            y--;
+            dx += 2 * b * b;
+            dy -= 2 * a * a;
+            d1 += dx - dy + b * b;
+        }
+        push();
+    }
+
+    double d2 = b * b * (x + 0.5) * (x + 0.5) + a * a * (y - 1.0) * (y - 1.0) - static_cast<double>(a) * a * b * b;
+    while (y >= 0) {
+        if (d2 > 0) {
+            y--;
+            dy -= 2 * a * a;
+            d2 += a * a - dy;
+        } else {
+            x++;
+            y--;
+            dx += 2 * b * b;
+            dy -= 2 * a * a;
+            d2 += dx - dy + a * a;
+        }
+        push();
+    }
+    offsets->shrink_to_fit();
+    bytes += offsets->size() * sizeof(OffsetPair);
+    return *offsets;
+}
+
+// 按 8 路对称平移输出，顺序与 DrawCircleMidpoint 相同
+template <typename Plot>
+static void ReplayCircle(const std::vector<OffsetPair>& offsets, int cx, int cy, Plot& plot)
+{
+    for (const OffsetPair& p : offsets) {
+        int x = p.x;
+        int y = p.y;
+        plot(cx + x, cy + y);
+        plot(cx - x, cy + y);
+        plot(cx + x, cy - y);
+        plot(cx - x, cy - y);
+        plot(cx + y, cy + x);
+        plot(cx - y, cy + x);
+        plot(cx + y, cy - x);
+        plot(cx - y, cy - x);
+    }
+}
+
+// 按 4 路对称平移输出，顺序与 DrawEllipseMidpoint 相同
+template <typename Plot>
+static void ReplayEllipse(const std::vector<OffsetPair>& offsets, int cx, int cy, Plot& plot)
+{
+    for (const OffsetPair& p : offsets) {
+        int x = p.x;
+        int y = p.y;
+        plot(cx + x, cy + y);
+        plot(cx - x, cy + y);
+        plot(cx + x, cy - y);
+        plot(cx - x, cy - y);
+    }
+}
+
+// 目标能给出 PixelBuffer 时直接写内存，其他目标走虚函数；rx、ry 为图形在两个方向上的半径
+template <typename Replay>
+static void ReplayToTarget(RasterTarget& target, int cx, int cy, int rx, int ry, ImU32 color, const std::vector<OffsetPair>& offsets, int points_per_offset, Replay replay)
+{
+    if (PixelBuffer* buffer = target.AsPixelBuffer(cx - rx, cy - ry, cx + rx, cy + ry)) {
+        BufferPlot<true> plot { buffer->pixels.data(), buffer->width, buffer->height, color };
+        replay(offsets, cx, cy, plot);
+        return;
+    }
+    target.Reserve(static_cast<int>(offsets.size()) * points_per_offset);
+    TargetPlot plot { target, color };
+    replay(offsets, cx, cy, plot);
+}
+
+void DrawCircleMidpointCached(RasterTarget& target,
+    ImVec2 center,
+    int radius,
+    ImU32 color,
+    ConicOffsetCache& cache)
+{
+    // 负半径或超出 int16 范围时不缓存
+    if (radius < 0 || radius > ConicOffsetCache::kMaxRadius) {
+        DrawCircleMidpoint(target, center, radius, color);
+        return;
+    }
+
+    int cx = static_cast<int>(std::floor(center.x + 0.5f));
+    int cy = static_cast<int>(std::floor(center.y + 0.5f));
+    ReplayToTarget(target, cx, cy, radius, radius, color, cache.CircleOffsets(radius), 8,
+        [](const std::vector<OffsetPair>& offsets, int cx, int cy, auto& plot) { ReplayCircle(offsets, cx, cy, plot); });
+}
+
+void DrawCircleMidpointCached(ImDrawList* draw_list,
+    ImVec2 center,
+    int radius,
+    ImU32 color,
+    ConicOffsetCache& cache)
+{
+    DrawListTarget target(draw_list, center, 1.0f);
+    DrawCircleMidpointCached(target, ImVec2(0.0f, 0.0f), radius, color, cache);
+}
+
+void DrawEllipseMidpointCached(RasterTarget& target,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color,
+    ConicOffsetCache& cache)
+{
+    // 中点椭圆的决策变量用 int 计算，a * a * b 超出 int 范围时不缓存
+    long long largest = std::max(static_cast<long long>(a) * a * b, static_cast<long long>(b) * b * a);
+    if (a < 0 || b < 0 || a > ConicOffsetCache::kMaxRadius || b > ConicOffsetCache::kMaxRadius || largest > INT_MAX / 4) {
+        DrawEllipseMidpoint(target, center, a, b, color);
+        return;
+    }
+
+    int cx = static_cast<int>(std::floor(center.x + 0.5f));
+    int cy = static_cast<int>(std::floor(center.y + 0.5f));
+    ReplayToTarget(target, cx, cy, a, b, color, cache.EllipseOffsets(a, b), 4,
+        [](const std::vector<OffsetPair>& offsets, int cx, int cy, auto& plot) { ReplayEllipse(offsets, cx, cy, plot); });
+}
+
+void DrawEllipseMidpointCached(ImDrawList* draw_list,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color,
+    ConicOffsetCache& cache)
+{
+    DrawListTarget target(draw_list, center, 1.0f);
+    DrawEllipseMidpointCached(target, ImVec2(0.0f, 0.0f), a, b, color, cache);
+}
@@ -0,0 +1,83 @@
+#ifndef CONICOFFSETCACHE_H
+#define CONICOFFSETCACHE_H
+
+#include "RasterTarget.h"
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// 中点算法走出的一个偏移点，相对圆心/椭圆中心
+struct OffsetPair {
+    int16_t x, y;
+};
+
+// 圆和椭圆的偏移表缓存（LRU，容量按条目数限制）
+// 圆按半径缓存第一个八分圆的偏移，椭圆按 (a, b) 缓存第一象限的偏移，
+// 重绘同样大小的图形时直接按 8 路 / 4 路对称平移输出，不再重新跑中点算法
+struct ConicOffsetCache {
+    // 偏移用 int16 存储，超出范围的半径不缓存
+    static const int kMaxRadius = 32767;
+
+    size_t capacity; // 最多缓存的条目数
+    size_t hits;
+    size_t misses;
+
+    explicit ConicOffsetCache(size_t capacity = 64);
+
+    // 返回半径为 radius 的圆在第一个八分圆内的偏移 (x, y)，0 <= x <= y
+    // 返回的引用在下一次查询之前有效（之后可能被淘汰）
+    const std::vector<OffsetPair>& CircleOffsets(int radius);
+
+    // 返回半轴为 a、b 的椭圆在第一象限的偏移
+    const std::vector<OffsetPair>& EllipseOffsets(int a, int b);
+
+    size_t EntryCount() const { return entries.size(); }
+
+    // 偏移表占用的字节数（不含容器自身的开销）
+    size_t MemoryBytes() const { return bytes; }
+
+    void Clear();
+
+private:
+    struct Entry {
+        uint64_t key;
+        std::vector<OffsetPair> offsets;
+    };
+
+    std::list<Entry> entries; // 最近使用的在前
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> lookup;
+    size_t bytes;
+
+    // 命中时移到最前并返回 true；未命中时在最前插入一个空条目并返回 false
+    bool Acquire(uint64_t key, std::vector<OffsetPair>*& offsets);
+};
+
+// 使用缓存的偏移表绘制圆/椭圆，像素与 DrawCircleMidpoint / DrawEllipseMidpoint 完全相同
+void DrawCircleMidpointCached(RasterTarget& target,
+    ImVec2 center,
+    int radius,
+    ImU32 color,
+    ConicOffsetCache& cache);
+
+void DrawCircleMidpointCached(ImDrawList* draw_list,
+    ImVec2 center,
+    int radius,
+    ImU32 color,
+    ConicOffsetCache& cache);
+
+void DrawEllipseMidpointCached(RasterTarget& target,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color,
+    ConicOffsetCache& cache);
+
+void DrawEllipseMidpointCached(ImDrawList* draw_list,
+    ImVec2 center,
+    int a,
+    int b,
+    ImU32 color,
+    ConicOffsetCache& cache);
+
+#endif // CONICOFFSETCACHE_H
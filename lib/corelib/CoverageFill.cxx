@@ -0,0 +1,261 @@
+#include "CoverageFill.h"
+#include <algorithm>
+#include <cmath>
+
+// 覆盖率低于半个灰阶的像素不输出，高于 1 减半个灰阶的按完全覆盖处理
+static constexpr float kMinCoverage = 0.5f / 255.0f;
+static constexpr float kFullCoverage = 1.0f - 0.5f / 255.0f;
+
+// 线段 (x0, y0) - (x1, y1) 对累加缓冲的贡献，要求 0 <= x <= 窗口宽度、0 <= y <= 行数
+// 每行中，线段在第 i 格内的部分把面积差分写入第 i 格和第 i + 1 格，
+// 行前缀和为像素中被线段左侧覆盖的有向面积（向下的边为正）
+static void AccumulateLine(float* cells, int stride, float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1)
+        return;
+    float dir = 1.0f;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        dir = -1.0f;
+    }
+    const float dxdy = (x1 - x0) / (y1 - y0);
+    const float xlo = std::min(x0, x1), xhi = std::max(x0, x1);
+    float x = x0;
+    const int rowBegin = static_cast<int>(std::floor(y0));
+    const int rowEnd = static_cast<int>(std::ceil(y1));
+    for (int row = rowBegin; row < rowEnd; ++row) {
+        float* line = cells + static_cast<size_t>(row) * stride;
+        const float dy = std::min(static_cast<float>(row + 1), y1) - std::max(static_cast<float>(row), y0);
+        const float xnext = std::min(std::max(x + dxdy * dy, xlo), xhi); // 累加误差不能越出线段的 x 范围
+        const float d = dy * dir;
+        const float left = std::min(x, xnext);
+        const float right = std::max(x, xnext);
+        const float leftFloor = std::floor(left);
+        const int li = static_cast<int>(leftFloor);
+        const int ri = static_cast<int>(std::ceil(right));
+
+        if (ri <= li + 1) {
+            // 这一行只经过一格：格内面积按线段中点到格左侧的距离分配
+            const float mid = 0.5f * (x + xnext) - leftFloor;
+            line[li] += d - d * mid;
+            line[li + 1] += d * mid;
+        } else {
+            // 经过多格：首尾两格是三角形，中间各格按斜率线性增加
+            const float s = 1.0f / (right - left);
+            const float lf = left - leftFloor;
+            const float a0 = 0.5f * s * (1.0f - lf) * (1.0f - lf);
+            const float rf = right - static_cast<float>(ri) + 1.0f;
+            const float am = 0.5f * s * rf * rf;
+            line[li] += d * a0;
+            if (ri == li + 2) {
+                line[li + 1] += d * (1.0f - a0 - am);
+            } else {
+                const float a1 = s * (1.5f - lf);
+                line[li + 1] += d * (a1 - a0);
+                for (int i = li + 2; i < ri - 1; ++i)
+                    line[i] += d * s;
+                const float a2 = a1 + static_cast<float>(ri - li - 3) * s;
+                line[ri - 1] += d * (1.0f - a2 - am);
+            }
+            line[ri] += d * am;
+        }
+        x = xnext;
+    }
+}
+
+// 把线段裁剪到 [0, rows) 行，再在 x = 0 和 x = width 处切开并把 x 夹到 [0, width]：
+// 窗口左侧的部分变成贴着左边界的竖线，仍然覆盖右侧整行；右侧的部分只影响窗口外的两格
+static void AccumulateClipped(float* cells, int stride, int width, int rows, float x0, float y0, float x1, float y1)
+{
+    const float top = 0.0f, bottom = static_cast<float>(rows);
+    if ((y0 <= top && y1 <= top) || (y0 >= bottom && y1 >= bottom) || y0 == y1)
+        return;
+    const float dxdy = (x1 - x0) / (y1 - y0);
+    if (y0 < top) {
+        x0 += (top - y0) * dxdy;
+        y0 = top;
+    } else if (y0 > bottom) {
+        x0 += (bottom - y0) * dxdy;
+        y0 = bottom;
+    }
+    if (y1 < top) {
+        x1 += (top - y1) * dxdy;
+        y1 = top;
+    } else if (y1 > bottom) {
+        x1 += (bottom - y1) * dxdy;
+        y1 = bottom;
+    }
+
+    const float right = static_cast<float>(width);
+    float t[4] = { 0.0f };
+    int count = 1;
+    if ((x0 < 0.0f) != (x1 < 0.0f))
+        t[count++] = (0.0f - x0) / (x1 - x0);
+    if ((x0 > right) != (x1 > right))
+        t[count++] = (right - x0) / (x1 - x0);
+    if (count == 3 && t[1] > t[2])
+        std::swap(t[1], t[2]);
+    t[count++] = 1.0f;
+
+    float px = std::min(std::max(x0, 0.0f), right), py = y0;
+    for (int i = 1; i < count; ++i) {
+        float nx = i + 1 == count ? x1 : x0 + (x1 - x0) * t[i];
+        float ny = i + 1 == count ? y1 : y0 + (y1 - y0) * t[i];
+        nx = std::min(std::max(nx, 0.0f), right);
+        AccumulateLine(cells, stride, px, py, nx, ny);
+        px = nx;
+        py = ny;
+    }
+}
+
+// 颜色的 alpha 乘以 0..255 的覆盖率
+static inline ImU32 ScaleAlpha(ImU32 color, int coverage)
+{
+    unsigned alpha = ((color >> IM_COL32_A_SHIFT) & 0xFF) * coverage + 127;
+    alpha = (alpha + (alpha >> 8)) >> 8; // 除以 255
+    return (color & ~IM_COL32_A_MASK) | (alpha << IM_COL32_A_SHIFT);
+}
+
+// 非预乘 alpha 的 source-over 混合；目标不透明时就是按 alpha 线性插值
+static inline ImU32 BlendOver(ImU32 dst, ImU32 src)
+{
+    const unsigned sa = (src >> IM_COL32_A_SHIFT) & 0xFF;
+    const unsigned da = (dst >> IM_COL32_A_SHIFT) & 0xFF;
+    const unsigned dw = da * (255 - sa); // 目标颜色的权重，放大了 255 倍
+    const unsigned outA = sa * 255 + dw; // 同样放大了 255 倍
+    if (outA == 0)
+        return 0;
+    ImU32 out = 0;
+    for (int shift = 0; shift < 24; shift += 8) {
+        unsigned c = (((src >> shift) & 0xFF) * sa * 255 + ((dst >> shift) & 0xFF) * dw + outA / 2) / outA;
+        out |= c << shift;
+    }
+    return out | (((outA + 127) / 255) << IM_COL32_A_SHIFT);
+}
+
+// 对一行累加值求前缀和并清零，按覆盖率输出像素
+// full(a, b) 输出完全覆盖的段 [a, b]，partial(x, coverage) 输出边缘像素（coverage 为 1..254）
+template <typename Full, typename Partial>
+static void SweepCoverageRow(float* cells, int stride, int width, bool nonzero, Full& full, Partial& partial)
+{
+    float sum = 0.0f;
+    int runStart = -1;
+    for (int i = 0; i < width; ++i) {
+        sum += cells[i];
+        cells[i] = 0.0f;
+        float coverage = std::abs(sum);
+        if (nonzero) {
+            coverage = std::min(coverage, 1.0f);
+        } else {
+            // 奇偶规则：覆盖面积按 2 取模后折回 [0, 1]
+            coverage -= 2.0f * std::floor(coverage * 0.5f);
+            if (coverage > 1.0f)
+                coverage = 2.0f - coverage;
+        }
+
+        if (coverage >= kFullCoverage) {
+            if (runStart < 0)
+                runStart = i;
+            continue;
+        }
+        if (runStart >= 0) {
+            full(runStart, i - 1);
+            runStart = -1;
+        }
+        if (coverage >= kMinCoverage)
+            partial(i, static_cast<int>(coverage * 255.0f + 0.5f));
+    }
+    if (runStart >= 0)
+        full(runStart, width - 1);
+    for (int i = width; i < stride; ++i)
+        cells[i] = 0.0f;
+}
+
+void FillPolygonCoverage(RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    FillRule rule,
+    CoverageScratch& scratch)
+{
+    if (vertexCount < 3)
+        return; // 多边形至少需要3个顶点
+
+    // 1. 包围盒：与多边形有交的像素为 [floor(xmin), ceil(xmax) - 1] x [floor(ymin), ceil(ymax) - 1]，再与裁剪范围求交
+    float xmin = x[0], xmax = x[0], ymin = y[0], ymax = y[0];
+    for (int i = 1; i < vertexCount; ++i) {
+        xmin = std::min(xmin, x[i]);
+        xmax = std::max(xmax, x[i]);
+        ymin = std::min(ymin, y[i]);
+        ymax = std::max(ymax, y[i]);
+    }
+    float left = std::floor(xmin), right = std::ceil(xmax) - 1.0f;
+    float top = std::floor(ymin), bottom = std::ceil(ymax) - 1.0f;
+    int clipXmin, clipYmin, clipXmax, clipYmax;
+    if (target.GetClipRect(clipXmin, clipYmin, clipXmax, clipYmax)) {
+        left = std::max(left, static_cast<float>(clipXmin));
+        right = std::min(right, static_cast<float>(clipXmax));
+        top = std::max(top, static_cast<float>(clipYmin));
+        bottom = std::min(bottom, static_cast<float>(clipYmax));
+    }
+    if (left > right || top > bottom)
+        return;
+    const int wx0 = static_cast<int>(left), wy0 = static_cast<int>(top);
+    const int width = static_cast<int>(right) - wx0 + 1;
+    const int height = static_cast<int>(bottom) - wy0 + 1;
+    const int stride = width + 2;
+    const int bandRows = std::max(1, std::min(height, CoverageScratch::kMaxCells / stride));
+
+    // 2. 边换到窗口坐标，跳过水平边
+    std::vector<CoverageScratch::Line>& lines = scratch.lines;
+    lines.clear();
+    for (int i = 0; i < vertexCount; ++i) {
+        int next = (i + 1) == vertexCount ? 0 : i + 1;
+        if (y[i] == y[next])
+            continue;
+        lines.push_back({ x[i] - left, y[i] - top, x[next] - left, y[next] - top });
+    }
+
+    // 累加缓冲在每次调用结束时都已清零，扩容时新增的部分也是 0
+    std::vector<float>& cells = scratch.cells;
+    if (cells.size() < static_cast<size_t>(bandRows) * stride)
+        cells.resize(static_cast<size_t>(bandRows) * stride, 0.0f);
+
+    PixelBuffer* buffer = target.AsPixelBuffer(wx0, wy0, wx0 + width - 1, wy0 + height - 1);
+    const bool opaque = ((color >> IM_COL32_A_SHIFT) & 0xFF) == 0xFF;
+    const bool nonzero = rule == FILL_NONZERO;
+
+    for (int band0 = 0; band0 < height; band0 += bandRows) {
+        const int rows = std::min(bandRows, height - band0);
+        const float shift = static_cast<float>(band0);
+
+        // 3. 累加各边在这条带内的面积
+        for (const CoverageScratch::Line& l : lines)
+            AccumulateClipped(cells.data(), stride, width, rows, l.x0, l.y0 - shift, l.x1, l.y1 - shift);
+
+        // 4. 逐行前缀求和并输出
+        for (int r = 0; r < rows; ++r) {
+            float* row = cells.data() + static_cast<size_t>(r) * stride;
+            const int py = wy0 + band0 + r;
+            if (buffer) {
+                ImU32* pixels = buffer->pixels.data() + static_cast<size_t>(py) * buffer->width + wx0;
+                auto full = [&](int a, int b) {
+                    if (opaque) {
+                        std::fill(pixels + a, pixels + b + 1, color);
+                    } else {
+                        for (int i = a; i <= b; ++i)
+                            pixels[i] = BlendOver(pixels[i], color);
+                    }
+                };
+                auto partial = [&](int i, int coverage) { pixels[i] = BlendOver(pixels[i], ScaleAlpha(color, coverage)); };
+                SweepCoverageRow(row, stride, width, nonzero, full, partial);
+            } else {
+                auto full = [&](int a, int b) { target.PlotSpan(wx0 + a, wx0 + b, py, color); };
+                auto partial = [&](int i, int coverage) { target.Plot(wx0 + i, py, ScaleAlpha(color, coverage)); };
+                SweepCoverageRow(row, stride, width, nonzero, full, partial);
+            }
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#ifndef COVERAGEFILL_H
+#define COVERAGEFILL_H
+
+#include "ScanlineFill.h"
+#include <vector>
+
+// 解析覆盖率填充的工作缓冲，多次调用之间复用
+// 累加缓冲每行 stride = 窗口宽度 + 2 个 float，边落在窗口右边界上时会写到最右两格；
+// 每次调用结束时累加缓冲全部清零，下次调用不需要再清
+struct CoverageScratch {
+    // 一次处理的行数按累加缓冲不超过这么多个 float（1 MB）划分
+    static constexpr int kMaxCells = 1 << 18;
+
+    // 相对窗口左上角的边，保持原来的方向
+    struct Line {
+        float x0, y0, x1, y1;
+    };
+
+    std::vector<Line> lines;
+    std::vector<float> cells;
+};
+
+// 抗锯齿填充多边形：按边累加每个像素的有向面积，不做超采样
+// 1. 每条边逐行走过它经过的像素，把边与像素右侧之间的有向面积（area）和此后整格的覆盖（cover）
+//    以差分形式写入累加缓冲，与 imstb_truetype 的第二版光栅化相同
+// 2. 逐行前缀求和得到每个像素被覆盖的面积，再按填充规则换算成 0..1 的覆盖率
+// 耗时为 O(边长 + 包围盒面积)，与超采样倍数无关
+// 能给出 PixelBuffer 的目标（见 AsPixelBuffer）按覆盖率与原像素做 alpha 混合；其他目标完全覆盖的段用 PlotSpan，
+// 边缘像素用 Plot 输出 alpha 乘以覆盖率的颜色，由目标自己混合（例如 ImDrawList）
+void FillPolygonCoverage(RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    FillRule rule,
+    CoverageScratch& scratch);
+
+#endif // COVERAGEFILL_H
@@ -0,0 +1,298 @@
+#include "EdgeFlagFill.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// 根据编译选项选择前缀异或内核（打开 CORELIB_ENABLE_AVX2 时一次处理 4 个字）
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define EDGEFLAG_AVX2 1
+#endif
+#if defined(__PCLMUL__)
+#include <wmmintrin.h>
+#define EDGEFLAG_CLMUL 1
+#endif
+
+// 每行的字数向上取整到这个数，AVX2 内核每次处理一组
+static constexpr int kWordsPerBlock = 4;
+
+// 最低的 1 所在的位（bits 不为 0）
+static inline int LowestBit(uint64_t bits)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+// 64 位字内的前缀异或：结果的第 i 位是 bits 第 0..i 位的异或
+static inline uint64_t PrefixXor64(uint64_t bits)
+{
+#if defined(EDGEFLAG_CLMUL)
+    // 与全 1 做无进位乘法，积的低 64 位就是前缀异或
+    __m128i product = _mm_clmulepi64_si128(_mm_cvtsi64_si128(static_cast<long long>(bits)), _mm_set1_epi64x(-1), 0);
+    return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+#else
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+#endif
+}
+
+// 一组 4 个字的前缀异或（原地），carry 为左侧所有字的奇偶，处理完更新为包含这一组的奇偶
+static inline void PrefixXorBlock(uint64_t* words, uint64_t& carry)
+{
+#if defined(EDGEFLAG_AVX2)
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+    v = _mm256_xor_si256(v, _mm256_slli_epi64(v, 1));
+    v = _mm256_xor_si256(v, _mm256_slli_epi64(v, 2));
+    v = _mm256_xor_si256(v, _mm256_slli_epi64(v, 4));
+    v = _mm256_xor_si256(v, _mm256_slli_epi64(v, 8));
+    v = _mm256_xor_si256(v, _mm256_slli_epi64(v, 16));
+    v = _mm256_xor_si256(v, _mm256_slli_epi64(v, 32));
+
+    // 每个字的最高位是这个字自身的奇偶；求出每个字左侧的奇偶后，奇数的字整体取反
+    int parity = _mm256_movemask_pd(_mm256_castsi256_pd(v));
+    parity ^= parity << 1;
+    parity ^= parity << 2;
+    int invert = ((parity << 1) & 0xF) ^ (carry ? 0xF : 0);
+    const __m256i lane = _mm256_setr_epi64x(1, 2, 4, 8);
+    __m256i mask = _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(invert), lane), lane);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(words), _mm256_xor_si256(v, mask));
+    carry ^= static_cast<uint64_t>((parity >> 3) & 1);
+#else
+    for (int i = 0; i < kWordsPerBlock; ++i) {
+        uint64_t bits = PrefixXor64(words[i]) ^ (0 - carry);
+        words[i] = bits;
+        carry = bits >> 63;
+    }
+#endif
+}
+
+// 对一行标志求前缀异或并清零，把其中连续的 1 作为段 [x0 + a, x0 + b] 交给 emit
+// 只有前 width 列有效，右侧补齐的位不输出
+template <typename Emit>
+static void SweepFlagRow(uint64_t* words, int stride, int width, int x0, Emit& emit)
+{
+    const int validWords = (width + 63) >> 6;
+    const uint64_t lastMask = (width & 63) ? (1ULL << (width & 63)) - 1 : ~0ULL;
+    uint64_t carry = 0;
+    uint64_t previous = 0; // 上一个字的最高位
+    int spanStart = 0;
+    for (int block = 0; block < stride && block < validWords; block += kWordsPerBlock) {
+        uint64_t bits[kWordsPerBlock];
+        std::copy(words + block, words + block + kWordsPerBlock, bits);
+        std::fill(words + block, words + block + kWordsPerBlock, 0);
+        PrefixXorBlock(bits, carry);
+
+        for (int i = 0; i < kWordsPerBlock && block + i < validWords; ++i) {
+            uint64_t inside = bits[i];
+            if (block + i == validWords - 1)
+                inside &= lastMask;
+            // 与左侧一位不同的位置是段的起点或终点
+            uint64_t change = inside ^ ((inside << 1) | previous);
+            previous = inside >> 63;
+            const int base = (block + i) << 6;
+            while (change) {
+                int bit = LowestBit(change);
+                change &= change - 1;
+                if ((inside >> bit) & 1)
+                    spanStart = base + bit;
+                else
+                    emit(x0 + spanStart, x0 + base + bit - 1);
+            }
+        }
+    }
+    if (previous)
+        emit(x0 + spanStart, x0 + validWords * 64 - 1);
+}
+
+namespace {
+
+// 要处理的像素窗口：列 [x0, x1]，行 [y0, y1]，标志缓冲每行 stride 个字
+struct FlagWindow {
+    int x0, y0, x1, y1;
+    int width, stride;
+};
+
+} // namespace
+
+// 1. 建边，同时求包围盒
+// 2. 可能被填充的像素：列 [ceil(xmin), ceil(xmax) - 1]，行 [ceil(ymin), ceil(ymax) - 1]，再与裁剪范围求交
+// 没有要处理的像素时返回 false
+static bool BuildFlagEdges(const RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    std::vector<EdgeFlagScratch::Edge>& edges,
+    FlagWindow& window)
+{
+    edges.clear();
+    float xmin = x[0], xmax = x[0], ymin = y[0], ymax = y[0];
+    for (int i = 0; i < vertexCount; ++i) {
+        int next = (i + 1) == vertexCount ? 0 : i + 1;
+        float x0 = x[i], y0 = y[i], x1 = x[next], y1 = y[next];
+        xmin = std::min(xmin, x0);
+        xmax = std::max(xmax, x0);
+        ymin = std::min(ymin, y0);
+        ymax = std::max(ymax, y0);
+        if (y0 == y1)
+            continue; // 忽略水平边
+        if (y0 > y1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        EdgeFlagScratch::Edge edge;
+        edge.x0 = x0;
+        edge.y0 = y0;
+        edge.dx = (x1 - x0) / (y1 - y0);
+        edge.row0 = static_cast<int>(std::ceil(y0));
+        edge.row1 = static_cast<int>(std::ceil(y1));
+        if (edge.row0 < edge.row1)
+            edges.push_back(edge);
+    }
+    if (edges.empty())
+        return false;
+
+    float left = std::ceil(xmin), right = std::ceil(xmax) - 1.0f;
+    float top = std::ceil(ymin), bottom = std::ceil(ymax) - 1.0f;
+    int clipXmin, clipYmin, clipXmax, clipYmax;
+    if (target.GetClipRect(clipXmin, clipYmin, clipXmax, clipYmax)) {
+        left = std::max(left, static_cast<float>(clipXmin));
+        right = std::min(right, static_cast<float>(clipXmax));
+        top = std::max(top, static_cast<float>(clipYmin));
+        bottom = std::min(bottom, static_cast<float>(clipYmax));
+    }
+    if (left > right || top > bottom)
+        return false;
+    window.x0 = static_cast<int>(left);
+    window.x1 = static_cast<int>(right);
+    window.y0 = static_cast<int>(top);
+    window.y1 = static_cast<int>(bottom);
+    window.width = window.x1 - window.x0 + 1;
+    window.stride = ((window.width + 63) / 64 + kWordsPerBlock - 1) / kWordsPerBlock * kWordsPerBlock;
+    return true;
+}
+
+// 填充窗口中 [row0, row1) 行，emit(row, a, b) 输出一段；标志缓冲放不下时分成若干行带依次处理
+// flags 中的标志在返回时全部清零
+template <typename EmitSpan>
+static void FillFlagRows(const std::vector<EdgeFlagScratch::Edge>& edges,
+    const FlagWindow& window,
+    int row0,
+    int row1,
+    std::vector<uint64_t>& flags,
+    EmitSpan&& emit)
+{
+    const int stride = window.stride;
+    const int bandRows = std::max(1, std::min(row1 - row0, EdgeFlagScratch::kMaxFlagWords / stride));
+
+    // 标志在每次调用结束时都已清零，扩容时新增的部分也是 0
+    if (flags.size() < static_cast<size_t>(bandRows) * stride)
+        flags.resize(static_cast<size_t>(bandRows) * stride, 0);
+
+    const float left = static_cast<float>(window.x0);
+    const float rightEdge = static_cast<float>(window.x1);
+    for (int band0 = row0; band0 < row1; band0 += bandRows) {
+        const int band1 = std::min(band0 + bandRows, row1);
+
+        // 3. 标记交点：交点 xc 使第 ceil(xc) 列及其右侧翻转，所以只翻转第 ceil(xc) 列的标志
+        for (const EdgeFlagScratch::Edge& edge : edges) {
+            const int r0 = std::max(edge.row0, band0);
+            const int r1 = std::min(edge.row1, band1);
+            for (int row = r0; row < r1; ++row) {
+                float xc = edge.x0 + edge.dx * (static_cast<float>(row) - edge.y0);
+                if (xc > rightEdge)
+                    continue; // 交点在窗口右侧，不影响窗口内的像素
+                int col = xc <= left ? 0 : static_cast<int>(std::ceil(xc)) - window.x0;
+                flags[static_cast<size_t>(row - band0) * stride + (col >> 6)] ^= 1ULL << (col & 63);
+            }
+        }
+
+        // 4. 逐行前缀异或，输出段
+        for (int row = band0; row < band1; ++row) {
+            uint64_t* words = flags.data() + static_cast<size_t>(row - band0) * stride;
+            auto emitRow = [&](int a, int b) { emit(row, a, b); };
+            SweepFlagRow(words, stride, window.width, window.x0, emitRow);
+        }
+    }
+}
+
+void FillPolygonEdgeFlag(RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    EdgeFlagScratch& scratch)
+{
+    if (vertexCount < 3)
+        return; // 多边形至少需要3个顶点
+
+    FlagWindow window;
+    if (!BuildFlagEdges(target, x, y, vertexCount, scratch.edges, window))
+        return;
+
+    // 目标能给出 PixelBuffer 时直接写内存，其他目标按段调用 PlotSpan
+    if (PixelBuffer* buffer = target.AsPixelBuffer(window.x0, window.y0, window.x1, window.y1)) {
+        ImU32* pixels = buffer->pixels.data();
+        const size_t pitch = static_cast<size_t>(buffer->width);
+        FillFlagRows(scratch.edges, window, window.y0, window.y1 + 1, scratch.flags, [&](int row, int a, int b) {
+            std::fill(pixels + row * pitch + a, pixels + row * pitch + b + 1, color);
+        });
+    } else {
+        FillFlagRows(scratch.edges, window, window.y0, window.y1 + 1, scratch.flags, [&](int row, int a, int b) {
+            target.PlotSpan(a, b, row, color);
+        });
+    }
+}
+
+// 自动分带时每条带的最少行数，行数太少时分带的开销超过并行的收益
+static const int kMinBandRows = 16;
+
+void FillPolygonEdgeFlagParallel(PixelBuffer& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    ThreadPool& pool,
+    int bandCount)
+{
+    if (vertexCount < 3)
+        return; // 多边形至少需要3个顶点
+
+    // 边只建一次，所有带共享（只读）
+    // thread_local 变量不会被 lambda 捕获，工作线程里要通过引用访问调用线程的这一份
+    static thread_local std::vector<EdgeFlagScratch::Edge> edgeScratch;
+    std::vector<EdgeFlagScratch::Edge>& edges = edgeScratch;
+    FlagWindow window;
+    if (!BuildFlagEdges(target, x, y, vertexCount, edges, window))
+        return;
+
+    const int visibleRows = window.y1 - window.y0 + 1;
+    if (bandCount <= 0)
+        bandCount = pool.ThreadCount() * 4; // 每个线程几条带，边分布不均时也能负载均衡
+    bandCount = std::max(1, std::min(bandCount, visibleRows / kMinBandRows));
+
+    ImU32* pixels = target.pixels.data();
+    const size_t pitch = static_cast<size_t>(target.width);
+    pool.ParallelFor(bandCount, [&](int band) {
+        const int first = window.y0 + static_cast<int>(static_cast<long long>(visibleRows) * band / bandCount);
+        const int last = window.y0 + static_cast<int>(static_cast<long long>(visibleRows) * (band + 1) / bandCount);
+
+        // 标志缓冲每个线程一份；每条带只写自己的行，不同线程之间没有共享的像素
+        static thread_local std::vector<uint64_t> flags;
+        FillFlagRows(edges, window, first, last, flags, [&](int row, int a, int b) {
+            std::fill(pixels + row * pitch + a, pixels + row * pitch + b + 1, color);
+        });
+    });
+}
@@ -0,0 +1,54 @@
+#ifndef EDGEFLAGFILL_H
+#define EDGEFLAGFILL_H
+
+#include "RasterTarget.h"
+#include <cstdint>
+#include <vector>
+
+struct ThreadPool;
+
+// 边标志法的工作缓冲，多次调用之间复用
+// 标志缓冲每行占 stride 个 64 位字，第 c 列是第 c / 64 个字的第 c % 64 位；
+// 每次调用结束时标志全部清零，下次调用不需要再清
+struct EdgeFlagScratch {
+    // 一次处理的行数按标志缓冲不超过这么多个字（1 MB）划分，宽多边形分成若干行带
+    static constexpr int kMaxFlagWords = 1 << 17;
+
+    // 一条边：(x0, y0) 为下端点，经过 [row0, row1) 行
+    struct Edge {
+        float x0, y0, dx;
+        int row0, row1;
+    };
+
+    std::vector<Edge> edges;
+    std::vector<uint64_t> flags;
+};
+
+// 边标志法填充多边形（奇偶规则）
+// 1. 每条边在它经过的每一行把交点处的标志位翻转一次（按位异或）
+// 2. 逐行对标志位求前缀异或：某一位左侧（含自身）被翻转奇数次就在内部，再把连续的 1 转成水平段输出
+// 前缀异或在 64 位字内用无进位乘法（PCLMUL）或移位级联完成，打开 CORELIB_ENABLE_AVX2 时一次处理 4 个字（256 个像素），
+// 字之间只需传递一位奇偶；整个过程没有排序也没有活动边表，耗时主要取决于包围盒的面积（内存带宽）
+// 采样规则与 FillSceneTiled 相同：边经过满足 y0 <= y < y1 的行，像素按交点 xc <= x 的边计数，
+// 所以局部极值顶点和整数交点上的像素与有序边表法不同
+// 只处理包围盒与 GetClipRect 的交集；能给出 PixelBuffer 的目标（见 AsPixelBuffer）直接写内存，其他目标按段调用 PlotSpan
+void FillPolygonEdgeFlag(RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    EdgeFlagScratch& scratch);
+
+// 按行分带并行的边标志法填充，像素与 FillPolygonEdgeFlag 完全相同
+// 边只建一次；每条带在自己的线程上标记交点并逐行输出，标志缓冲每个线程一份，
+// 各带只写自己的行，所以目标限定为 PixelBuffer。只处理缓冲区内的行
+// bandCount 为 0 时按线程数自动选择，每条带至少 16 行
+void FillPolygonEdgeFlagParallel(PixelBuffer& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    ThreadPool& pool,
+    int bandCount = 0);
+
+#endif // EDGEFLAGFILL_H
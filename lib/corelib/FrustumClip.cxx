@@ -0,0 +1,237 @@
+#include "FrustumClip.h"
+#include <algorithm>
+
+// 点到第 plane 个平面的有向距离（乘以 w 的尺度），不小于 0 时在内侧
+static inline float PlaneDistance(const ImVec4& v, int plane)
+{
+    switch (plane) {
+    case 0:
+        return v.w + v.x;
+    case 1:
+        return v.w - v.x;
+    case 2:
+        return v.w + v.y;
+    case 3:
+        return v.w - v.y;
+    case 4:
+        return v.w + v.z;
+    default:
+        return v.w - v.z;
+    }
+}
+
+static inline ImVec4 Lerp(const ImVec4& a, const ImVec4& b, float t)
+{
+    return ImVec4(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t);
+}
+
+int FrustumOutCode(const ImVec4& v)
+{
+    // 写成 !(d >= 0)，NaN 算作在外侧
+    int code = 0;
+    if (!(v.w + v.x >= 0.0f))
+        code |= FRUSTUM_LEFT;
+    if (!(v.w - v.x >= 0.0f))
+        code |= FRUSTUM_RIGHT;
+    if (!(v.w + v.y >= 0.0f))
+        code |= FRUSTUM_BOTTOM;
+    if (!(v.w - v.y >= 0.0f))
+        code |= FRUSTUM_TOP;
+    if (!(v.w + v.z >= 0.0f))
+        code |= FRUSTUM_NEAR;
+    if (!(v.w - v.z >= 0.0f))
+        code |= FRUSTUM_FAR;
+    return code;
+}
+
+ImVec2 ProjectToViewport(const ImVec4& v, const FrustumViewport& viewport)
+{
+    const float invW = 1.0f / v.w;
+    return ImVec2(viewport.x0 + (v.x * invW + 1.0f) * 0.5f * (viewport.x1 - viewport.x0),
+        viewport.y0 + (v.y * invW + 1.0f) * 0.5f * (viewport.y1 - viewport.y0));
+}
+
+bool ClipLineHomogeneous(ImVec4& a, ImVec4& b)
+{
+    const int codeA = FrustumOutCode(a);
+    const int codeB = FrustumOutCode(b);
+    if (codeA & codeB)
+        return false;
+    const int planes = codeA | codeB;
+    for (int plane = 0; plane < 6; ++plane) {
+        if (!(planes & (1 << plane)))
+            continue;
+        const float da = PlaneDistance(a, plane);
+        const float db = PlaneDistance(b, plane);
+        const bool insideA = da >= 0.0f;
+        const bool insideB = db >= 0.0f;
+        if (insideA == insideB) {
+            if (!insideA)
+                return false;
+            continue;
+        }
+        // 距离异号时 t 在 [0, 1] 内；含 NaN 时比较不成立，整条线段舍弃
+        const float t = insideA ? da / (da - db) : db / (db - da);
+        if (!(t >= 0.0f && t <= 1.0f))
+            return false;
+        if (insideA)
+            b = Lerp(a, b, t);
+        else
+            a = Lerp(b, a, t);
+    }
+    return true;
+}
+
+// 凸多边形对一个平面的 Sutherland-Hodgman 裁剪，最多写出 capacity 个顶点
+// 凸多边形每次最多多出一个顶点；接近共线的顶点因舍入多出的顶点直接丢弃，不会写越界
+static int ClipPolygonPlane(const ImVec4* in, int n, int plane, ImVec4* out, int capacity)
+{
+    int m = 0;
+    ImVec4 prev = in[n - 1];
+    float prevDistance = PlaneDistance(prev, plane);
+    for (int i = 0; i < n; ++i) {
+        const ImVec4 cur = in[i];
+        const float curDistance = PlaneDistance(cur, plane);
+        const bool prevInside = prevDistance >= 0.0f;
+        const bool curInside = curDistance >= 0.0f;
+        if (prevInside != curInside && m < capacity) {
+            // 从内侧的端点开始插值
+            const float t = prevInside ? prevDistance / (prevDistance - curDistance) : curDistance / (curDistance - prevDistance);
+            if (t >= 0.0f && t <= 1.0f)
+                out[m++] = prevInside ? Lerp(prev, cur, t) : Lerp(cur, prev, t);
+        }
+        if (curInside && m < capacity)
+            out[m++] = cur;
+        prev = cur;
+        prevDistance = curDistance;
+    }
+    return m;
+}
+
+int ClipTriangleHomogeneous(const ImVec4& a, const ImVec4& b, const ImVec4& c, ImVec4* out)
+{
+    const int codeA = FrustumOutCode(a);
+    const int codeB = FrustumOutCode(b);
+    const int codeC = FrustumOutCode(c);
+    if (codeA & codeB & codeC)
+        return 0;
+    out[0] = a;
+    out[1] = b;
+    out[2] = c;
+    const int planes = codeA | codeB | codeC;
+    if (planes == 0)
+        return 3;
+
+    // 在 out 和局部缓冲之间来回裁剪
+    ImVec4 buffer[FrustumClipScratch::kMaxTriangleVertices];
+    ImVec4* src = out;
+    ImVec4* dst = buffer;
+    int n = 3;
+    for (int plane = 0; plane < 6; ++plane) {
+        if (!(planes & (1 << plane)))
+            continue;
+        n = ClipPolygonPlane(src, n, plane, dst, FrustumClipScratch::kMaxTriangleVertices);
+        if (n < 3)
+            return 0;
+        std::swap(src, dst);
+    }
+    if (src != out)
+        std::copy(src, src + n, out);
+    return n;
+}
+
+// 计算所有顶点的区域码；有顶点可见时再投影视见体内的顶点。返回所有区域码的与
+static int ClassifyVertices(const ImVec4* vertices,
+    int vertexCount,
+    const FrustumViewport& viewport,
+    FrustumClipScratch& scratch)
+{
+    scratch.outcode.resize(vertexCount);
+    int codeAnd = FRUSTUM_LEFT | FRUSTUM_RIGHT | FRUSTUM_BOTTOM | FRUSTUM_TOP | FRUSTUM_NEAR | FRUSTUM_FAR;
+    for (int i = 0; i < vertexCount; ++i) {
+        scratch.outcode[i] = FrustumOutCode(vertices[i]);
+        codeAnd &= scratch.outcode[i];
+    }
+    if (codeAnd)
+        return codeAnd;
+
+    scratch.screen.resize(vertexCount);
+    for (int i = 0; i < vertexCount; ++i) {
+        if (scratch.outcode[i] == 0)
+            scratch.screen[i] = ProjectToViewport(vertices[i], viewport);
+    }
+    return 0;
+}
+
+size_t ClipProjectLines(const ImVec4* vertices,
+    int vertexCount,
+    const int* edges,
+    int edgeCount,
+    const FrustumViewport& viewport,
+    std::vector<ImVec2>& out,
+    FrustumClipScratch& scratch)
+{
+    out.clear();
+    if (ClassifyVertices(vertices, vertexCount, viewport, scratch))
+        return 0;
+
+    for (int i = 0; i < edgeCount; ++i) {
+        const int ia = edges[2 * i];
+        const int ib = edges[2 * i + 1];
+        const int codeA = scratch.outcode[ia];
+        const int codeB = scratch.outcode[ib];
+        if ((codeA | codeB) == 0) {
+            out.push_back(scratch.screen[ia]);
+            out.push_back(scratch.screen[ib]);
+            continue;
+        }
+        if (codeA & codeB)
+            continue;
+        ImVec4 a = vertices[ia];
+        ImVec4 b = vertices[ib];
+        if (ClipLineHomogeneous(a, b)) {
+            out.push_back(codeA ? ProjectToViewport(a, viewport) : scratch.screen[ia]);
+            out.push_back(codeB ? ProjectToViewport(b, viewport) : scratch.screen[ib]);
+        }
+    }
+    return out.size() / 2;
+}
+
+size_t ClipProjectTriangles(const ImVec4* vertices,
+    int vertexCount,
+    const int* triangles,
+    int triangleCount,
+    const FrustumViewport& viewport,
+    std::vector<ImVec2>& out,
+    FrustumClipScratch& scratch)
+{
+    out.clear();
+    if (ClassifyVertices(vertices, vertexCount, viewport, scratch))
+        return 0;
+
+    ImVec4 polygon[FrustumClipScratch::kMaxTriangleVertices];
+    ImVec2 projected[FrustumClipScratch::kMaxTriangleVertices];
+    for (int i = 0; i < triangleCount; ++i) {
+        const int* index = triangles + 3 * i;
+        const int codeA = scratch.outcode[index[0]];
+        const int codeB = scratch.outcode[index[1]];
+        const int codeC = scratch.outcode[index[2]];
+        if ((codeA | codeB | codeC) == 0) {
+            out.push_back(scratch.screen[index[0]]);
+            out.push_back(scratch.screen[index[1]]);
+            out.push_back(scratch.screen[index[2]]);
+            continue;
+        }
+        if (codeA & codeB & codeC)
+            continue;
+        const int n = ClipTriangleHomogeneous(vertices[index[0]], vertices[index[1]], vertices[index[2]], polygon);
+        for (int k = 0; k < n; ++k)
+            projected[k] = ProjectToViewport(polygon[k], viewport);
+        for (int k = 1; k + 1 < n; ++k) {
+            out.push_back(projected[0]);
+            out.push_back(projected[k]);
+            out.push_back(projected[k + 1]);
+        }
+    }
+    return out.size() / 3;
+}
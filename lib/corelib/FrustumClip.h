@@ -0,0 +1,71 @@
+#ifndef FRUSTUMCLIP_H
+#define FRUSTUMCLIP_H
+
+#include <imgui.h>
+#include <vector>
+
+// 齐次裁剪坐标 (x, y, z, w) 中的视见体：-w <= x <= w，-w <= y <= w，-w <= z <= w
+// 在透视除法之前裁剪，视点后方（w <= 0）的点被近平面裁掉，除法不会溢出或把图形翻到屏幕另一侧
+// 区域码的每一位表示点在对应平面的外侧
+enum FrustumPlane {
+    FRUSTUM_LEFT = 1, // x < -w
+    FRUSTUM_RIGHT = 2, // x > w
+    FRUSTUM_BOTTOM = 4, // y < -w
+    FRUSTUM_TOP = 8, // y > w
+    FRUSTUM_NEAR = 16, // z < -w
+    FRUSTUM_FAR = 32 // z > w
+};
+
+// 点的区域码；含 NaN 的点在所有平面外侧
+int FrustumOutCode(const ImVec4& v);
+
+// 透视除法后的规范化坐标映射到屏幕矩形：x = -1 对应 x0，x = 1 对应 x1，y 同理
+struct FrustumViewport {
+    float x0, y0, x1, y1;
+};
+
+// 透视除法并映射到视口，v 必须在视见体内（w > 0）
+ImVec2 ProjectToViewport(const ImVec4& v, const FrustumViewport& viewport);
+
+// 按 Sutherland-Hodgman 的方式依次用 6 个平面裁剪线段，只处理两端区域码中出现的平面
+// 线段完全在视见体外时返回 false；端点不被裁剪时保持原值
+// 交点总是从平面内侧的端点开始插值，相邻图元共用的边两边裁剪的结果相同
+bool ClipLineHomogeneous(ImVec4& a, ImVec4& b);
+
+// 物体批量裁剪投影的工作缓冲，多次调用之间复用
+struct FrustumClipScratch {
+    // 一个三角形被 6 个平面裁剪后最多的顶点数
+    static constexpr int kMaxTriangleVertices = 9;
+
+    std::vector<int> outcode; // 每个顶点的区域码
+    std::vector<ImVec2> screen; // 视见体内顶点的屏幕坐标
+};
+
+// 三角形裁剪为凸多边形，写入 out（至少 FrustumClipScratch::kMaxTriangleVertices 个），返回顶点数
+// 完全在视见体外时返回 0，完全在内时原样写出三个顶点
+int ClipTriangleHomogeneous(const ImVec4& a, const ImVec4& b, const ImVec4& c, ImVec4* out);
+
+// 裁剪一个线框物体并投影到视口：第 i 条边连接顶点 edges[2i] 和 edges[2i + 1]
+// 先算所有顶点的区域码：所有顶点在同一平面外侧时直接返回，不再看边；每个视见体内的顶点只做一次除法，
+// 两端都在视见体内的边直接使用投影结果，只有跨越平面的边才做裁剪
+// 结果写入 out（先清空），每两个点为一条线段；返回线段数
+size_t ClipProjectLines(const ImVec4* vertices,
+    int vertexCount,
+    const int* edges,
+    int edgeCount,
+    const FrustumViewport& viewport,
+    std::vector<ImVec2>& out,
+    FrustumClipScratch& scratch);
+
+// 三角形网格：第 i 个三角形为顶点 triangles[3i]、triangles[3i + 1]、triangles[3i + 2]
+// 跨越平面的三角形裁剪成凸多边形后按扇形重新分成三角形，环绕方向不变
+// 结果写入 out（先清空），每三个点为一个三角形；返回三角形数
+size_t ClipProjectTriangles(const ImVec4* vertices,
+    int vertexCount,
+    const int* triangles,
+    int triangleCount,
+    const FrustumViewport& viewport,
+    std::vector<ImVec2>& out,
+    FrustumClipScratch& scratch);
+
+#endif // FRUSTUMCLIP_H
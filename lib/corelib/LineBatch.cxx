@@ -0,0 +1,165 @@
+#include "LineBatch.h"
+#include "Algorithm.h"
+#include <algorithm>
+#include <cmath>
+
+// 根据编译选项选择批量内核（打开 CORELIB_ENABLE_AVX2 时使用 AVX2）
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LINEBATCH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LINEBATCH_SSE2 1
+#endif
+
+// 单条线段的 DDA 步进，与 DrawLineDDA 逐步一致
+template <typename Emit>
+static void StepLineDDAScalar(const RasterTarget* clip, float x0, float y0, float x1, float y1, Emit& emit)
+{
+    LineDDASetup dda;
+    if (!SetupLineDDA(clip, ImVec2(x0, y0), ImVec2(x1, y1), dda))
+        return;
+
+    float x = dda.x;
+    float y = dda.y;
+    for (int i = dda.first; i <= dda.last; i++) {
+        emit(static_cast<int>(std::floor(x + 0.5f)), static_cast<int>(std::floor(y + 0.5f)));
+        x += dda.x_inc;
+        y += dda.y_inc;
+    }
+}
+
+#if defined(LINEBATCH_SSE2)
+// SSE2 没有 floor 指令：先截断，截断结果比原值大时再减一
+static inline __m128i FloorToInt(__m128 v)
+{
+    __m128i t = _mm_cvttps_epi32(v);
+    __m128 back = _mm_cvtepi32_ps(t);
+    return _mm_add_epi32(t, _mm_castps_si128(_mm_cmpgt_ps(back, v)));
+}
+#endif
+
+namespace {
+
+// 一组 SIMD 通道的步进状态，每个通道负责一条线段
+// 某条通道的线段画完后立即换上下一条线段，长短不一的线段也能让所有通道保持忙碌
+template <int Lanes>
+struct DDALanes {
+    alignas(32) float x[Lanes];
+    alignas(32) float y[Lanes];
+    alignas(32) float xInc[Lanes];
+    alignas(32) float yInc[Lanes];
+    alignas(32) int xs[Lanes];
+    alignas(32) int ys[Lanes];
+    int remaining[Lanes]; // 还要输出的像素数，0 表示通道空闲
+
+    // 把第 index 条线段装入通道，起点、增量和步数范围与 DrawLineDDA 完全相同
+    // 线段在 clip 的可见范围外时返回 false，通道保持空闲
+    bool Load(int lane, const LineSegmentsSoA& lines, size_t index, const RasterTarget* clip)
+    {
+        LineDDASetup dda;
+        if (!SetupLineDDA(clip, ImVec2(lines.x0[index], lines.y0[index]), ImVec2(lines.x1[index], lines.y1[index]), dda))
+            return false;
+        x[lane] = dda.x;
+        y[lane] = dda.y;
+        xInc[lane] = dda.x_inc;
+        yInc[lane] = dda.y_inc;
+        remaining[lane] = dda.last - dda.first + 1;
+        return true;
+    }
+};
+
+} // namespace
+
+// 批量 DDA 内核：所有通道同时取整、同时步进，再逐通道输出像素
+// 每条通道的浮点运算顺序与标量版本相同，所以结果逐像素一致；clip 不为 nullptr 时按它的可见范围裁剪每条线段
+template <typename Emit>
+static void StepLinesDDA(const RasterTarget* clip, const LineSegmentsSoA& lines, Emit& emit)
+{
+    const size_t count = lines.Size();
+
+#if defined(LINEBATCH_AVX2) || defined(LINEBATCH_SSE2)
+#if defined(LINEBATCH_AVX2)
+    const int kLanes = 8;
+#else
+    const int kLanes = 4;
+#endif
+    DDALanes<kLanes> lanes;
+    size_t next = 0;
+    // 给通道装入下一条有可见像素的线段，线段用完时返回 false
+    auto refill = [&](int lane) {
+        while (next < count) {
+            if (lanes.Load(lane, lines, next++, clip))
+                return true;
+        }
+        lanes.remaining[lane] = 0;
+        return false;
+    };
+    int active = 0;
+    for (int lane = 0; lane < kLanes; ++lane) {
+        if (refill(lane))
+            active++;
+    }
+
+#if defined(LINEBATCH_AVX2)
+    const __m256 half = _mm256_set1_ps(0.5f);
+#else
+    const __m128 half = _mm_set1_ps(0.5f);
+#endif
+
+    while (active > 0) {
+        // 向量部分：取整当前坐标并前进一步
+#if defined(LINEBATCH_AVX2)
+        __m256 x = _mm256_load_ps(lanes.x);
+        __m256 y = _mm256_load_ps(lanes.y);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.xs), _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(x, half))));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.ys), _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(y, half))));
+        _mm256_store_ps(lanes.x, _mm256_add_ps(x, _mm256_load_ps(lanes.xInc)));
+        _mm256_store_ps(lanes.y, _mm256_add_ps(y, _mm256_load_ps(lanes.yInc)));
+#else
+        __m128 x = _mm_load_ps(lanes.x);
+        __m128 y = _mm_load_ps(lanes.y);
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes.xs), FloorToInt(_mm_add_ps(x, half)));
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes.ys), FloorToInt(_mm_add_ps(y, half)));
+        _mm_store_ps(lanes.x, _mm_add_ps(x, _mm_load_ps(lanes.xInc)));
+        _mm_store_ps(lanes.y, _mm_add_ps(y, _mm_load_ps(lanes.yInc)));
+#endif
+
+        // 标量部分：输出像素，画完的通道换上新线段
+        for (int lane = 0; lane < kLanes; ++lane) {
+            if (lanes.remaining[lane] == 0)
+                continue;
+            emit(lanes.xs[lane], lanes.ys[lane]);
+            if (--lanes.remaining[lane] == 0 && !refill(lane))
+                active--;
+        }
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        StepLineDDAScalar(clip, lines.x0[i], lines.y0[i], lines.x1[i], lines.y1[i], emit);
+    }
+#endif
+}
+
+void DrawLinesDDA(RasterTarget& target, const LineSegmentsSoA& lines, ImU32 color)
+{
+    auto emit = [&](int x, int y) { target.Plot(x, y, color); };
+    StepLinesDDA(&target, lines, emit);
+}
+
+void DrawLinesDDA(std::vector<PixelCoord>& pixels, const LineSegmentsSoA& lines)
+{
+    auto emit = [&](int x, int y) { pixels.push_back(PixelCoord { x, y }); };
+    StepLinesDDA(nullptr, lines, emit);
+}
+
+const char* LineBatchKernelName()
+{
+#if defined(LINEBATCH_AVX2)
+    return "AVX2";
+#elif defined(LINEBATCH_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
@@ -0,0 +1,48 @@
+#ifndef LINEBATCH_H
+#define LINEBATCH_H
+
+#include "RasterTarget.h"
+#include <vector>
+
+// SoA 布局的线段集合：四个坐标分量各自连续存放，便于 SIMD 一次加载多条线段
+struct LineSegmentsSoA {
+    std::vector<float> x0, y0, x1, y1;
+
+    size_t Size() const { return x0.size(); }
+
+    void Reserve(size_t count)
+    {
+        x0.reserve(count);
+        y0.reserve(count);
+        x1.reserve(count);
+        y1.reserve(count);
+    }
+
+    void Add(ImVec2 start, ImVec2 end)
+    {
+        x0.push_back(start.x);
+        y0.push_back(start.y);
+        x1.push_back(end.x);
+        y1.push_back(end.y);
+    }
+
+    void Clear()
+    {
+        x0.clear();
+        y0.clear();
+        x1.clear();
+        y1.clear();
+    }
+};
+
+// 批量 DDA：一次步进多条线段（AVX2 每次 8 条，SSE2 每次 4 条，否则逐条）
+// 每条线段装入时按目标的可见范围裁剪步数（SetupLineDDA），像素与逐条调用 DrawLineDDA 完全相同
+void DrawLinesDDA(RasterTarget& target, const LineSegmentsSoA& lines, ImU32 color);
+
+// 同上，但把像素坐标依次追加到 pixels 中（不清空原有内容）；没有可见范围，每条线段走完全部步数
+void DrawLinesDDA(std::vector<PixelCoord>& pixels, const LineSegmentsSoA& lines);
+
+// 当前编译进来的批量内核名称（"AVX2"、"SSE2" 或 "Scalar"）
+const char* LineBatchKernelName();
+
+#endif // LINEBATCH_H
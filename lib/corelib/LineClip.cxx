@@ -0,0 +1,594 @@
+#include "LineClip.h"
+#include "Algorithm.h"
+#include <algorithm>
+
+// 根据编译选项选择批量内核（打开 CORELIB_ENABLE_AVX2 时使用 AVX2）
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LINECLIP_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LINECLIP_SSE2 1
+#endif
+
+#if defined(LINECLIP_AVX2)
+static constexpr int kClipLanes = 8;
+#elif defined(LINECLIP_SSE2)
+static constexpr int kClipLanes = 4;
+#else
+static constexpr int kClipLanes = 1;
+#endif
+
+namespace {
+
+// 裁剪结果的写入位置：输出数组预先多留 kClipLanes 个位置，向量内核可以整组写入
+struct ClipOutput {
+    float *x0, *y0, *x1, *y1;
+    int* index; // 为空时不记录下标
+    size_t count;
+
+    void Push(float ax, float ay, float bx, float by, size_t i)
+    {
+        x0[count] = ax;
+        y0[count] = ay;
+        x1[count] = bx;
+        y1[count] = by;
+        if (index)
+            index[count] = static_cast<int>(i);
+        count++;
+    }
+};
+
+} // namespace
+
+// 输出数组预留 count + kClipLanes 个位置
+static ClipOutput BeginClipOutput(size_t count, LineSegmentsSoA& out, std::vector<int>* indices)
+{
+    out.x0.resize(count + kClipLanes);
+    out.y0.resize(count + kClipLanes);
+    out.x1.resize(count + kClipLanes);
+    out.y1.resize(count + kClipLanes);
+    if (indices)
+        indices->resize(count + kClipLanes);
+    return ClipOutput { out.x0.data(), out.y0.data(), out.x1.data(), out.y1.data(), indices ? indices->data() : nullptr, 0 };
+}
+
+// 截掉多留的位置，返回留下的线段数
+static size_t EndClipOutput(const ClipOutput& result, LineSegmentsSoA& out, std::vector<int>* indices)
+{
+    out.x0.resize(result.count);
+    out.y0.resize(result.count);
+    out.x1.resize(result.count);
+    out.y1.resize(result.count);
+    if (indices)
+        indices->resize(result.count);
+    return result.count;
+}
+
+// 第 i 条线段走原来的迭代裁剪
+static inline void ClipOneCohenSutherland(const LineSegmentsSoA& lines, size_t i, float xmin, float ymin, float xmax, float ymax, ClipOutput& out)
+{
+    float x0 = lines.x0[i], y0 = lines.y0[i], x1 = lines.x1[i], y1 = lines.y1[i];
+    if (CohenSutherlandLineClip(x0, y0, x1, y1, xmin, ymin, xmax, ymax))
+        out.Push(x0, y0, x1, y1, i);
+}
+
+#if defined(LINECLIP_AVX2)
+// 8 个端点的区域码，与 ComputeOutCode 相同：x < xmin 时不再判断 x > xmax，y 同理
+static inline __m256i OutCodes8(__m256 x, __m256 y, __m256 xmin, __m256 ymin, __m256 xmax, __m256 ymax)
+{
+    __m256 left = _mm256_cmp_ps(x, xmin, _CMP_LT_OQ);
+    __m256 right = _mm256_andnot_ps(left, _mm256_cmp_ps(x, xmax, _CMP_GT_OQ));
+    __m256 bottom = _mm256_cmp_ps(y, ymin, _CMP_LT_OQ);
+    __m256 top = _mm256_andnot_ps(bottom, _mm256_cmp_ps(y, ymax, _CMP_GT_OQ));
+    __m256i code = _mm256_and_si256(_mm256_castps_si256(left), _mm256_set1_epi32(LEFT));
+    code = _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(right), _mm256_set1_epi32(RIGHT)));
+    code = _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(bottom), _mm256_set1_epi32(BOTTOM)));
+    return _mm256_or_si256(code, _mm256_and_si256(_mm256_castps_si256(top), _mm256_set1_epi32(TOP)));
+}
+
+namespace {
+
+// 压缩表：第 mask 行依次是 mask 中为 1 的通道号，用于把接受的通道挤到一起
+struct CompactTable {
+    alignas(32) int lanes[256][8];
+
+    CompactTable()
+    {
+        for (int mask = 0; mask < 256; ++mask) {
+            int n = 0;
+            for (int lane = 0; lane < 8; ++lane) {
+                if (mask & (1 << lane))
+                    lanes[mask][n++] = lane;
+            }
+            while (n < 8)
+                lanes[mask][n++] = 0;
+        }
+    }
+};
+
+} // namespace
+
+static const CompactTable kCompactTable;
+#elif defined(LINECLIP_SSE2)
+// 4 个端点的区域码，与 ComputeOutCode 相同
+static inline __m128i OutCodes4(__m128 x, __m128 y, __m128 xmin, __m128 ymin, __m128 xmax, __m128 ymax)
+{
+    __m128 left = _mm_cmplt_ps(x, xmin);
+    __m128 right = _mm_andnot_ps(left, _mm_cmpgt_ps(x, xmax));
+    __m128 bottom = _mm_cmplt_ps(y, ymin);
+    __m128 top = _mm_andnot_ps(bottom, _mm_cmpgt_ps(y, ymax));
+    __m128i code = _mm_and_si128(_mm_castps_si128(left), _mm_set1_epi32(LEFT));
+    code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(right), _mm_set1_epi32(RIGHT)));
+    code = _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(bottom), _mm_set1_epi32(BOTTOM)));
+    return _mm_or_si128(code, _mm_and_si128(_mm_castps_si128(top), _mm_set1_epi32(TOP)));
+}
+#endif
+
+size_t ClipLinesCohenSutherland(const LineSegmentsSoA& lines,
+    float xmin,
+    float ymin,
+    float xmax,
+    float ymax,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices)
+{
+    const size_t count = lines.Size();
+    ClipOutput result = BeginClipOutput(count, out, indices);
+
+    size_t i = 0;
+#if defined(LINECLIP_AVX2)
+    const __m256 vxmin = _mm256_set1_ps(xmin), vymin = _mm256_set1_ps(ymin);
+    const __m256 vxmax = _mm256_set1_ps(xmax), vymax = _mm256_set1_ps(ymax);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    for (; i + 8 <= count; i += 8) {
+        __m256 x0 = _mm256_loadu_ps(lines.x0.data() + i);
+        __m256 y0 = _mm256_loadu_ps(lines.y0.data() + i);
+        __m256 x1 = _mm256_loadu_ps(lines.x1.data() + i);
+        __m256 y1 = _mm256_loadu_ps(lines.y1.data() + i);
+        __m256i code0 = OutCodes8(x0, y0, vxmin, vymin, vxmax, vymax);
+        __m256i code1 = OutCodes8(x1, y1, vxmin, vymin, vxmax, vymax);
+
+        // 两端区域码都为 0 直接接受；区域码有公共位（在同一侧）直接舍弃
+        const int accept = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_or_si256(code0, code1), zero)));
+        const int reject = ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(code0, code1), zero))) & 0xFF;
+        const int ambiguous = ~(accept | reject) & 0xFF;
+
+        if (ambiguous == 0) {
+            // 接受的通道按顺序挤到一起，整组写入，多写的部分会被下一组覆盖
+            if (accept == 0)
+                continue;
+            const __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompactTable.lanes[accept]));
+            const size_t at = result.count;
+            _mm256_storeu_ps(result.x0 + at, _mm256_permutevar8x32_ps(x0, perm));
+            _mm256_storeu_ps(result.y0 + at, _mm256_permutevar8x32_ps(y0, perm));
+            _mm256_storeu_ps(result.x1 + at, _mm256_permutevar8x32_ps(x1, perm));
+            _mm256_storeu_ps(result.y1 + at, _mm256_permutevar8x32_ps(y1, perm));
+            if (result.index) {
+                __m256i index = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), laneIndex);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.index + at), _mm256_permutevar8x32_epi32(index, perm));
+            }
+            result.count += _mm_popcnt_u32(static_cast<unsigned>(accept));
+            continue;
+        }
+
+        // 有需要求交的通道时逐个处理，保持输入顺序
+        for (int lane = 0; lane < 8; ++lane) {
+            if (accept & (1 << lane))
+                result.Push(lines.x0[i + lane], lines.y0[i + lane], lines.x1[i + lane], lines.y1[i + lane], i + lane);
+            else if (ambiguous & (1 << lane))
+                ClipOneCohenSutherland(lines, i + lane, xmin, ymin, xmax, ymax, result);
+        }
+    }
+#elif defined(LINECLIP_SSE2)
+    const __m128 vxmin = _mm_set1_ps(xmin), vymin = _mm_set1_ps(ymin);
+    const __m128 vxmax = _mm_set1_ps(xmax), vymax = _mm_set1_ps(ymax);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4) {
+        __m128 x0 = _mm_loadu_ps(lines.x0.data() + i);
+        __m128 y0 = _mm_loadu_ps(lines.y0.data() + i);
+        __m128 x1 = _mm_loadu_ps(lines.x1.data() + i);
+        __m128 y1 = _mm_loadu_ps(lines.y1.data() + i);
+        __m128i code0 = OutCodes4(x0, y0, vxmin, vymin, vxmax, vymax);
+        __m128i code1 = OutCodes4(x1, y1, vxmin, vymin, vxmax, vymax);
+        const int accept = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_or_si128(code0, code1), zero)));
+        const int reject = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(code0, code1), zero))) & 0xF;
+
+        // SSE2 没有跨通道置换，只有整组接受时才整组写入
+        if (accept == 0xF) {
+            const size_t at = result.count;
+            _mm_storeu_ps(result.x0 + at, x0);
+            _mm_storeu_ps(result.y0 + at, y0);
+            _mm_storeu_ps(result.x1 + at, x1);
+            _mm_storeu_ps(result.y1 + at, y1);
+            if (result.index) {
+                for (int lane = 0; lane < 4; ++lane)
+                    result.index[at + lane] = static_cast<int>(i + lane);
+            }
+            result.count += 4;
+            continue;
+        }
+        if (reject == 0xF)
+            continue;
+        for (int lane = 0; lane < 4; ++lane) {
+            if (accept & (1 << lane))
+                result.Push(lines.x0[i + lane], lines.y0[i + lane], lines.x1[i + lane], lines.y1[i + lane], i + lane);
+            else if (!(reject & (1 << lane)))
+                ClipOneCohenSutherland(lines, i + lane, xmin, ymin, xmax, ymax, result);
+        }
+    }
+#endif
+    for (; i < count; ++i)
+        ClipOneCohenSutherland(lines, i, xmin, ymin, xmax, ymax, result);
+    return EndClipOutput(result, out, indices);
+}
+
+namespace {
+
+// 参数化裁剪（Liang-Barsky / Cyrus-Beck）的一个半平面：n · (P - a) >= 0 的一侧为内侧
+// 线段 P(t) = P0 + t * D 对这个半平面有 num + t * den >= 0，其中 num = n · (P0 - a)，den = n · D
+struct ClipPlane {
+    float ax, ay;
+    float nx, ny;
+};
+
+} // namespace
+
+// 矩形窗口的四个半平面，依次为左、右、下、上边界（与区域码的 LEFT、RIGHT、BOTTOM、TOP 对应）
+static void RectPlanes(float xmin, float ymin, float xmax, float ymax, ClipPlane planes[4])
+{
+    planes[0] = { xmin, ymin, 1.0f, 0.0f };
+    planes[1] = { xmax, ymin, -1.0f, 0.0f };
+    planes[2] = { xmin, ymin, 0.0f, 1.0f };
+    planes[3] = { xmin, ymax, 0.0f, -1.0f };
+}
+
+// 凸多边形窗口第 i 条边的半平面，法向量按多边形的方向翻转到内侧
+static inline ClipPlane ConvexPlane(const ImVec2* polygon, int count, int i, float orientation)
+{
+    const ImVec2& a = polygon[i];
+    const ImVec2& b = polygon[(i + 1) == count ? 0 : i + 1];
+    return ClipPlane { a.x, a.y, -(b.y - a.y) * orientation, (b.x - a.x) * orientation };
+}
+
+// 多边形的方向：有向面积为负时返回 -1
+static float PolygonOrientation(const ImVec2* polygon, int count)
+{
+    float area = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        const ImVec2& a = polygon[i];
+        const ImVec2& b = polygon[(i + 1) == count ? 0 : i + 1];
+        area += a.x * b.y - b.x * a.y;
+    }
+    return area < 0.0f ? -1.0f : 1.0f;
+}
+
+// 第 k 个半平面的 num、den
+// Axis 为 true 时半平面是 RectPlanes 给出的矩形边界，直接用坐标差（Liang-Barsky 的 q、-p），省去乘法
+template <bool Axis>
+static inline void PlaneTerms(const ClipPlane& plane, int k, float x0, float y0, float dx, float dy, float& num, float& den)
+{
+    if (Axis) {
+        switch (k) {
+        case 0:
+            num = x0 - plane.ax;
+            den = dx;
+            break;
+        case 1:
+            num = plane.ax - x0;
+            den = -dx;
+            break;
+        case 2:
+            num = y0 - plane.ay;
+            den = dy;
+            break;
+        default:
+            num = plane.ay - y0;
+            den = -dy;
+            break;
+        }
+    } else {
+        num = plane.nx * (x0 - plane.ax) + plane.ny * (y0 - plane.ay);
+        den = plane.nx * dx + plane.ny * dy;
+    }
+}
+
+// 用一个半平面收紧参数区间 [t0, t1]：den > 0 为进入，den < 0 为离开，den == 0 且 num < 0 时整条在外侧
+// 向量内核按同样的比较逐步计算，所以批量结果与逐条结果完全相同
+static inline void ClipAgainstPlane(float num, float den, float& t0, float& t1, bool& outside)
+{
+    if (den == 0.0f && num < 0.0f)
+        outside = true;
+    const float r = -num / den;
+    if (den > 0.0f && r > t0)
+        t0 = r;
+    if (den < 0.0f && r < t1)
+        t1 = r;
+}
+
+// 按参数区间截取线段，区间端点为 0 或 1 时保留原来的端点
+static inline bool ClipToInterval(float& x0, float& y0, float& x1, float& y1, float dx, float dy, float t0, float t1, bool outside)
+{
+    if (outside || !(t0 <= t1))
+        return false;
+    const float sx = x0, sy = y0;
+    if (t0 > 0.0f) {
+        x0 = sx + t0 * dx;
+        y0 = sy + t0 * dy;
+    }
+    if (t1 < 1.0f) {
+        x1 = sx + t1 * dx;
+        y1 = sy + t1 * dy;
+    }
+    return true;
+}
+
+template <bool Axis>
+static inline bool ClipParametric(float& x0, float& y0, float& x1, float& y1, const ClipPlane* planes, int planeCount)
+{
+    const float dx = x1 - x0, dy = y1 - y0;
+    float t0 = 0.0f, t1 = 1.0f;
+    bool outside = false;
+    for (int k = 0; k < planeCount; ++k) {
+        float num, den;
+        PlaneTerms<Axis>(planes[k], k, x0, y0, dx, dy, num, den);
+        ClipAgainstPlane(num, den, t0, t1, outside);
+    }
+    return ClipToInterval(x0, y0, x1, y1, dx, dy, t0, t1, outside);
+}
+
+bool LiangBarskyLineClip(float& x0, float& y0, float& x1, float& y1, float xmin, float ymin, float xmax, float ymax)
+{
+    ClipPlane planes[4];
+    RectPlanes(xmin, ymin, xmax, ymax, planes);
+    return ClipParametric<true>(x0, y0, x1, y1, planes, 4);
+}
+
+bool CyrusBeckLineClip(float& x0, float& y0, float& x1, float& y1, const ImVec2* window, int count)
+{
+    if (count < 3)
+        return false;
+    const float orientation = PolygonOrientation(window, count);
+    const float dx = x1 - x0, dy = y1 - y0;
+    float t0 = 0.0f, t1 = 1.0f;
+    bool outside = false;
+    for (int k = 0; k < count; ++k) {
+        float num, den;
+        PlaneTerms<false>(ConvexPlane(window, count, k, orientation), k, x0, y0, dx, dy, num, den);
+        ClipAgainstPlane(num, den, t0, t1, outside);
+    }
+    return ClipToInterval(x0, y0, x1, y1, dx, dy, t0, t1, outside);
+}
+
+#if defined(LINECLIP_AVX2) || defined(LINECLIP_SSE2)
+// 参数化裁剪内核用到的向量运算，AVX2 每次 8 条，SSE2 每次 4 条
+#if defined(LINECLIP_AVX2)
+typedef __m256 ClipVec;
+static inline ClipVec VLoad(const float* p) { return _mm256_loadu_ps(p); }
+static inline ClipVec VSet(float v) { return _mm256_set1_ps(v); }
+static inline ClipVec VAdd(ClipVec a, ClipVec b) { return _mm256_add_ps(a, b); }
+static inline ClipVec VSub(ClipVec a, ClipVec b) { return _mm256_sub_ps(a, b); }
+static inline ClipVec VMul(ClipVec a, ClipVec b) { return _mm256_mul_ps(a, b); }
+static inline ClipVec VDiv(ClipVec a, ClipVec b) { return _mm256_div_ps(a, b); }
+static inline ClipVec VNeg(ClipVec a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+static inline ClipVec VLt(ClipVec a, ClipVec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static inline ClipVec VGt(ClipVec a, ClipVec b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+static inline ClipVec VLe(ClipVec a, ClipVec b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+static inline ClipVec VEq(ClipVec a, ClipVec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+static inline ClipVec VAnd(ClipVec a, ClipVec b) { return _mm256_and_ps(a, b); }
+static inline ClipVec VAndNot(ClipVec a, ClipVec b) { return _mm256_andnot_ps(a, b); }
+static inline ClipVec VOr(ClipVec a, ClipVec b) { return _mm256_or_ps(a, b); }
+static inline ClipVec VSelect(ClipVec mask, ClipVec a, ClipVec b) { return _mm256_blendv_ps(b, a, mask); }
+static inline int VMask(ClipVec mask) { return _mm256_movemask_ps(mask); }
+
+// 接受的通道按顺序挤到一起整组写入
+static inline void StoreAccepted(ClipOutput& result, int accept, size_t first, ClipVec x0, ClipVec y0, ClipVec x1, ClipVec y1)
+{
+    const __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompactTable.lanes[accept]));
+    const size_t at = result.count;
+    _mm256_storeu_ps(result.x0 + at, _mm256_permutevar8x32_ps(x0, perm));
+    _mm256_storeu_ps(result.y0 + at, _mm256_permutevar8x32_ps(y0, perm));
+    _mm256_storeu_ps(result.x1 + at, _mm256_permutevar8x32_ps(x1, perm));
+    _mm256_storeu_ps(result.y1 + at, _mm256_permutevar8x32_ps(y1, perm));
+    if (result.index) {
+        __m256i index = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(first)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.index + at), _mm256_permutevar8x32_epi32(index, perm));
+    }
+    result.count += _mm_popcnt_u32(static_cast<unsigned>(accept));
+}
+#else
+typedef __m128 ClipVec;
+static inline ClipVec VLoad(const float* p) { return _mm_loadu_ps(p); }
+static inline ClipVec VSet(float v) { return _mm_set1_ps(v); }
+static inline ClipVec VAdd(ClipVec a, ClipVec b) { return _mm_add_ps(a, b); }
+static inline ClipVec VSub(ClipVec a, ClipVec b) { return _mm_sub_ps(a, b); }
+static inline ClipVec VMul(ClipVec a, ClipVec b) { return _mm_mul_ps(a, b); }
+static inline ClipVec VDiv(ClipVec a, ClipVec b) { return _mm_div_ps(a, b); }
+static inline ClipVec VNeg(ClipVec a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+static inline ClipVec VLt(ClipVec a, ClipVec b) { return _mm_cmplt_ps(a, b); }
+static inline ClipVec VGt(ClipVec a, ClipVec b) { return _mm_cmpgt_ps(a, b); }
+static inline ClipVec VLe(ClipVec a, ClipVec b) { return _mm_cmple_ps(a, b); }
+static inline ClipVec VEq(ClipVec a, ClipVec b) { return _mm_cmpeq_ps(a, b); }
+static inline ClipVec VAnd(ClipVec a, ClipVec b) { return _mm_and_ps(a, b); }
+static inline ClipVec VAndNot(ClipVec a, ClipVec b) { return _mm_andnot_ps(a, b); }
+static inline ClipVec VOr(ClipVec a, ClipVec b) { return _mm_or_ps(a, b); }
+static inline ClipVec VSelect(ClipVec mask, ClipVec a, ClipVec b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+static inline int VMask(ClipVec mask) { return _mm_movemask_ps(mask); }
+
+// SSE2 没有跨通道置换：整组接受时整组写入，否则逐个通道写入
+static inline void StoreAccepted(ClipOutput& result, int accept, size_t first, ClipVec x0, ClipVec y0, ClipVec x1, ClipVec y1)
+{
+    const size_t at = result.count;
+    if (accept == 0xF) {
+        _mm_storeu_ps(result.x0 + at, x0);
+        _mm_storeu_ps(result.y0 + at, y0);
+        _mm_storeu_ps(result.x1 + at, x1);
+        _mm_storeu_ps(result.y1 + at, y1);
+        if (result.index) {
+            for (int lane = 0; lane < 4; ++lane)
+                result.index[at + lane] = static_cast<int>(first + lane);
+        }
+        result.count += 4;
+        return;
+    }
+    alignas(16) float ax[4], ay[4], bx[4], by[4];
+    _mm_store_ps(ax, x0);
+    _mm_store_ps(ay, y0);
+    _mm_store_ps(bx, x1);
+    _mm_store_ps(by, y1);
+    for (int lane = 0; lane < 4; ++lane) {
+        if (accept & (1 << lane))
+            result.Push(ax[lane], ay[lane], bx[lane], by[lane], first + lane);
+    }
+}
+#endif
+
+// 与 PlaneTerms 相同的运算，一次处理一组通道
+template <bool Axis>
+static inline void PlaneTermsVec(const ClipPlane& plane, int k, ClipVec x0, ClipVec y0, ClipVec dx, ClipVec dy, ClipVec& num, ClipVec& den)
+{
+    if (Axis) {
+        switch (k) {
+        case 0:
+            num = VSub(x0, VSet(plane.ax));
+            den = dx;
+            break;
+        case 1:
+            num = VSub(VSet(plane.ax), x0);
+            den = VNeg(dx);
+            break;
+        case 2:
+            num = VSub(y0, VSet(plane.ay));
+            den = dy;
+            break;
+        default:
+            num = VSub(VSet(plane.ay), y0);
+            den = VNeg(dy);
+            break;
+        }
+    } else {
+        num = VAdd(VMul(VSet(plane.nx), VSub(x0, VSet(plane.ax))), VMul(VSet(plane.ny), VSub(y0, VSet(plane.ay))));
+        den = VAdd(VMul(VSet(plane.nx), dx), VMul(VSet(plane.ny), dy));
+    }
+}
+#endif
+
+// 批量参数化裁剪：每组通道同时对所有半平面收紧参数区间，没有分支，交点只在最后算一次
+template <bool Axis>
+static size_t ClipLinesParametric(const LineSegmentsSoA& lines, const ClipPlane* planes, int planeCount, LineSegmentsSoA& out, std::vector<int>* indices)
+{
+    const size_t count = lines.Size();
+    ClipOutput result = BeginClipOutput(count, out, indices);
+
+    size_t i = 0;
+#if defined(LINECLIP_AVX2) || defined(LINECLIP_SSE2)
+    const ClipVec zero = VSet(0.0f), one = VSet(1.0f);
+    for (; i + kClipLanes <= count; i += kClipLanes) {
+        ClipVec x0 = VLoad(lines.x0.data() + i);
+        ClipVec y0 = VLoad(lines.y0.data() + i);
+        ClipVec x1 = VLoad(lines.x1.data() + i);
+        ClipVec y1 = VLoad(lines.y1.data() + i);
+        ClipVec dx = VSub(x1, x0), dy = VSub(y1, y0);
+        ClipVec t0 = zero, t1 = one, outside = VSet(0.0f);
+        for (int k = 0; k < planeCount; ++k) {
+            ClipVec num, den;
+            PlaneTermsVec<Axis>(planes[k], k, x0, y0, dx, dy, num, den);
+            outside = VOr(outside, VAnd(VEq(den, zero), VLt(num, zero)));
+            ClipVec r = VDiv(VNeg(num), den);
+            t0 = VSelect(VAnd(VGt(den, zero), VGt(r, t0)), r, t0);
+            t1 = VSelect(VAnd(VLt(den, zero), VLt(r, t1)), r, t1);
+        }
+        const int accept = VMask(VAndNot(outside, VLe(t0, t1)));
+        if (accept == 0)
+            continue;
+        ClipVec cx0 = VSelect(VGt(t0, zero), VAdd(x0, VMul(t0, dx)), x0);
+        ClipVec cy0 = VSelect(VGt(t0, zero), VAdd(y0, VMul(t0, dy)), y0);
+        ClipVec cx1 = VSelect(VLt(t1, one), VAdd(x0, VMul(t1, dx)), x1);
+        ClipVec cy1 = VSelect(VLt(t1, one), VAdd(y0, VMul(t1, dy)), y1);
+        StoreAccepted(result, accept, i, cx0, cy0, cx1, cy1);
+    }
+#endif
+    for (; i < count; ++i) {
+        float x0 = lines.x0[i], y0 = lines.y0[i], x1 = lines.x1[i], y1 = lines.y1[i];
+        if (ClipParametric<Axis>(x0, y0, x1, y1, planes, planeCount))
+            result.Push(x0, y0, x1, y1, i);
+    }
+    return EndClipOutput(result, out, indices);
+}
+
+size_t ClipLinesLiangBarsky(const LineSegmentsSoA& lines,
+    float xmin,
+    float ymin,
+    float xmax,
+    float ymax,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices)
+{
+    ClipPlane planes[4];
+    RectPlanes(xmin, ymin, xmax, ymax, planes);
+    return ClipLinesParametric<true>(lines, planes, 4, out, indices);
+}
+
+size_t ClipLinesCyrusBeck(const LineSegmentsSoA& lines,
+    const ImVec2* window,
+    int count,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices)
+{
+    if (count < 3) {
+        ClipOutput result = BeginClipOutput(0, out, indices);
+        return EndClipOutput(result, out, indices);
+    }
+    std::vector<ClipPlane> planes(count);
+    const float orientation = PolygonOrientation(window, count);
+    for (int k = 0; k < count; ++k)
+        planes[k] = ConvexPlane(window, count, k, orientation);
+    return ClipLinesParametric<false>(lines, planes.data(), count, out, indices);
+}
+
+size_t ClipLines(LineClipAlgorithm algorithm,
+    const LineSegmentsSoA& lines,
+    const LineClipWindow& window,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices)
+{
+    if (!window.polygon.empty() || algorithm == LINE_CLIP_CYRUS_BECK) {
+        if (!window.polygon.empty())
+            return ClipLinesCyrusBeck(lines, window.polygon.data(), static_cast<int>(window.polygon.size()), out, indices);
+        const ImVec2 rect[4] = {
+            ImVec2(window.xmin, window.ymin),
+            ImVec2(window.xmax, window.ymin),
+            ImVec2(window.xmax, window.ymax),
+            ImVec2(window.xmin, window.ymax),
+        };
+        return ClipLinesCyrusBeck(lines, rect, 4, out, indices);
+    }
+    if (algorithm == LINE_CLIP_LIANG_BARSKY)
+        return ClipLinesLiangBarsky(lines, window.xmin, window.ymin, window.xmax, window.ymax, out, indices);
+    return ClipLinesCohenSutherland(lines, window.xmin, window.ymin, window.xmax, window.ymax, out, indices);
+}
+
+const char* LineClipAlgorithmName(LineClipAlgorithm algorithm)
+{
+    switch (algorithm) {
+    case LINE_CLIP_COHEN_SUTHERLAND:
+        return "Cohen-Sutherland";
+    case LINE_CLIP_LIANG_BARSKY:
+        return "Liang-Barsky";
+    case LINE_CLIP_CYRUS_BECK:
+        return "Cyrus-Beck";
+    }
+    return "Unknown";
+}
+
+const char* LineClipKernelName()
+{
+#if defined(LINECLIP_AVX2)
+    return "AVX2";
+#elif defined(LINECLIP_SSE2)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
@@ -0,0 +1,66 @@
+#ifndef LINECLIP_H
+#define LINECLIP_H
+
+#include "LineBatch.h"
+#include <vector>
+
+// 批量 Cohen-Sutherland 裁剪：一次计算多条线段两端的区域码（AVX2 每次 8 条，SSE2 每次 4 条，否则逐条）
+// 整组都能直接接受或直接舍弃时不再逐条处理；只有两端都不在窗口内又不在同一侧的线段才走迭代求交
+// 留下的线段按输入顺序紧凑地写入 out（先清空），indices 不为空时同时写入它们在 lines 中的下标
+// 每条线段的结果与逐条调用 CohenSutherlandLineClip 完全相同；返回留下的线段数
+size_t ClipLinesCohenSutherland(const LineSegmentsSoA& lines,
+    float xmin,
+    float ymin,
+    float xmax,
+    float ymax,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices = nullptr);
+
+// Liang-Barsky 裁剪：按参数 t 求出线段在窗口内的区间 [t0, t1]，每条边界只算一次除法，交点最后算一次
+// 与 CohenSutherlandLineClip 的接口相同；端点不被裁剪时保持原值
+bool LiangBarskyLineClip(float& x0, float& y0, float& x1, float& y1, float xmin, float ymin, float xmax, float ymax);
+
+// Cyrus-Beck 裁剪：窗口为任意凸多边形（顶点顺时针或逆时针均可，至少 3 个顶点），其余同 Liang-Barsky
+bool CyrusBeckLineClip(float& x0, float& y0, float& x1, float& y1, const ImVec2* window, int count);
+
+// 批量版本：输出方式与 ClipLinesCohenSutherland 相同，每条线段的结果与逐条调用完全相同
+size_t ClipLinesLiangBarsky(const LineSegmentsSoA& lines,
+    float xmin,
+    float ymin,
+    float xmax,
+    float ymax,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices = nullptr);
+
+size_t ClipLinesCyrusBeck(const LineSegmentsSoA& lines,
+    const ImVec2* window,
+    int count,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices = nullptr);
+
+// 统一的批量裁剪接口，运行时选择算法
+enum LineClipAlgorithm {
+    LINE_CLIP_COHEN_SUTHERLAND = 0,
+    LINE_CLIP_LIANG_BARSKY = 1,
+    LINE_CLIP_CYRUS_BECK = 2
+};
+
+// 裁剪窗口：轴对齐矩形 [xmin, xmax] x [ymin, ymax]，或者 polygon 不为空时为凸多边形
+// 凸多边形窗口只有 Cyrus-Beck 能处理，选择其他算法时也改用 Cyrus-Beck；矩形窗口三种算法都可以
+struct LineClipWindow {
+    float xmin, ymin, xmax, ymax;
+    std::vector<ImVec2> polygon;
+};
+
+size_t ClipLines(LineClipAlgorithm algorithm,
+    const LineSegmentsSoA& lines,
+    const LineClipWindow& window,
+    LineSegmentsSoA& out,
+    std::vector<int>* indices = nullptr);
+
+const char* LineClipAlgorithmName(LineClipAlgorithm algorithm);
+
+// 当前编译进来的批量裁剪内核名称（"AVX2"、"SSE2" 或 "Scalar"）
+const char* LineClipKernelName();
+
+#endif // LINECLIP_H
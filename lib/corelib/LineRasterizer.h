@@ -0,0 +1,255 @@
+#ifndef LINERASTERIZER_H
+#define LINERASTERIZER_H
+
+// 按八分象限特化的直线光栅化模板
+// 步进方向和主方向都是模板参数，内层循环中只剩决策变量一个数据相关的分支；
+// 像素的输出方式由绘制策略（plot policy）决定，plot(x, y) 可以在内层循环中内联
+
+#include "RasterTarget.h"
+#include "imgui_internal.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <vector>
+
+// 通用策略：通过 RasterTarget 的虚函数输出
+struct TargetPlot {
+    RasterTarget& target;
+    ImU32 color;
+
+    void operator()(int x, int y) { target.Plot(x, y, color); }
+};
+
+// 直接写 CPU 帧缓冲
+// Checked 为 false 时由调用方保证所有像素都在缓冲区内，内层循环不做越界判断
+template <bool Checked>
+struct BufferPlot {
+    ImU32* pixels;
+    int width;
+    int height;
+    ImU32 color;
+
+    void operator()(int x, int y)
+    {
+        if (Checked && (static_cast<unsigned>(x) >= static_cast<unsigned>(width) || static_cast<unsigned>(y) >= static_cast<unsigned>(height)))
+            return;
+        pixels[static_cast<size_t>(y) * width + x] = color;
+    }
+};
+
+// 只收集像素坐标
+struct PixelCollector {
+    std::vector<PixelCoord>& pixels;
+
+    void operator()(int x, int y) { pixels.push_back(PixelCoord { x, y }); }
+};
+
+// 直接往 ImDrawList 的顶点/索引缓冲写四边形（与 PrimRect 相同），按块 PrimReserve
+struct DrawListQuadPlot {
+    // 16 位索引下单次最多 65536 个顶点
+    static constexpr int kMaxQuadsPerChunk = 8192;
+
+    ImDrawList* draw_list;
+    ImVec2 origin;
+    float radius;
+    ImU32 color;
+    ImVec2 uv;
+    int remaining; // 预计还要写入的四边形数
+    int reserved; // 当前块中尚未写入的四边形数
+
+    DrawListQuadPlot(ImDrawList* list, ImVec2 origin, float radius, ImU32 color, int count)
+        : draw_list(list)
+        , origin(origin)
+        , radius(radius)
+        , color(color)
+        , uv(list->_Data->TexUvWhitePixel)
+        , remaining(count)
+        , reserved(0)
+    {
+    }
+
+    DrawListQuadPlot(const DrawListQuadPlot&) = delete;
+    DrawListQuadPlot& operator=(const DrawListQuadPlot&) = delete;
+
+    ~DrawListQuadPlot()
+    {
+        if (reserved > 0)
+            draw_list->PrimUnreserve(reserved * 6, reserved * 4);
+    }
+
+    void operator()(int x, int y)
+    {
+        if (reserved == 0) {
+            reserved = std::max(1, std::min(remaining, kMaxQuadsPerChunk));
+            draw_list->PrimReserve(reserved * 6, reserved * 4);
+        }
+        reserved--;
+        remaining--;
+
+        float px = origin.x + x;
+        float py = origin.y + y;
+        ImDrawIdx idx = static_cast<ImDrawIdx>(draw_list->_VtxCurrentIdx);
+        ImDrawIdx* indices = draw_list->_IdxWritePtr;
+        indices[0] = idx;
+        indices[1] = static_cast<ImDrawIdx>(idx + 1);
+        indices[2] = static_cast<ImDrawIdx>(idx + 2);
+        indices[3] = idx;
+        indices[4] = static_cast<ImDrawIdx>(idx + 2);
+        indices[5] = static_cast<ImDrawIdx>(idx + 3);
+
+        ImDrawVert* v = draw_list->_VtxWritePtr;
+        v[0].pos = ImVec2(px - radius, py - radius);
+        v[1].pos = ImVec2(px + radius, py - radius);
+        v[2].pos = ImVec2(px + radius, py + radius);
+        v[3].pos = ImVec2(px - radius, py + radius);
+        for (int k = 0; k < 4; ++k) {
+            v[k].uv = uv;
+            v[k].col = color;
+        }
+
+        draw_list->_VtxWritePtr += 4;
+        draw_list->_VtxCurrentIdx += 4;
+        draw_list->_IdxWritePtr += 6;
+    }
+};
+
+// 单个八分象限的中点/Bresenham 内核，只输出主方向第 first 到第 last 步的像素
+// (x, y) 为起点，major / minor 为主、次方向的增量绝对值；XStep、YStep 取 ±1，Steep 表示 y 为主方向
+// 第 i 步的次方向偏移为 m(i) = ceil((2*minor*i - major) / (2*major))（i = 0 时为 0），
+// 此时决策变量为 2*minor*(i+1) - major - 2*major*m(i)，所以可以直接跳到 first 而结果不变
+template <int XStep, int YStep, bool Steep, typename Plot>
+inline void RasterizeLineOctant(int x, int y, int major, int minor, int first, int last, Plot& plot)
+{
+    const int incE = 2 * minor; // 沿主方向的增量
+    const int incNE = 2 * (minor - major); // 沿次方向的增量
+    int d = 2 * minor - major; // 初始化决策变量
+
+    if (first > 0) {
+        long long numerator = 2LL * minor * first - major;
+        long long m = numerator > 0 ? (numerator + 2LL * major - 1) / (2LL * major) : 0;
+        d = static_cast<int>(2LL * minor * (first + 1) - major - 2LL * major * m);
+        if constexpr (Steep) {
+            x += XStep * static_cast<int>(m);
+            y += YStep * first;
+        } else {
+            x += XStep * first;
+            y += YStep * static_cast<int>(m);
+        }
+    }
+
+    plot(x, y);
+    for (int i = first; i < last; ++i) {
+        if (d > 0) {
+            if constexpr (Steep)
+                x += XStep;
+            else
+                y += YStep;
+            d += incNE;
+        } else {
+            d += incE;
+        }
+
+        if constexpr (Steep)
+            y += YStep;
+        else
+            x += XStep;
+
+        plot(x, y);
+    }
+}
+
+// 根据八分象限分派到对应的特化内核，像素与 DrawLineBresenham 完全相同
+// [first, last] 为要输出的主方向步数范围（会被限制在 [0, major] 内），默认输出整条直线
+template <typename Plot>
+void RasterizeLine(int x0, int y0, int x1, int y1, Plot& plot, int first = 0, int last = INT_MAX)
+{
+    int dx = std::abs(x1 - x0);
+    int dy = std::abs(y1 - y0);
+    int octant = (x1 > x0 ? 1 : 0) | (y1 > y0 ? 2 : 0) | (dy > dx ? 4 : 0);
+
+    first = std::max(first, 0);
+    last = std::min(last, std::max(dx, dy));
+    if (first > last)
+        return;
+
+    switch (octant) {
+    case 0: RasterizeLineOctant<-1, -1, false>(x0, y0, dx, dy, first, last, plot); break;
+    case 1: RasterizeLineOctant<1, -1, false>(x0, y0, dx, dy, first, last, plot); break;
+    case 2: RasterizeLineOctant<-1, 1, false>(x0, y0, dx, dy, first, last, plot); break;
+    case 3: RasterizeLineOctant<1, 1, false>(x0, y0, dx, dy, first, last, plot); break;
+    case 4: RasterizeLineOctant<-1, -1, true>(x0, y0, dy, dx, first, last, plot); break;
+    case 5: RasterizeLineOctant<1, -1, true>(x0, y0, dy, dx, first, last, plot); break;
+    case 6: RasterizeLineOctant<-1, 1, true>(x0, y0, dy, dx, first, last, plot); break;
+    case 7: RasterizeLineOctant<1, 1, true>(x0, y0, dy, dx, first, last, plot); break;
+    }
+}
+
+// 32.32 定点 DDA 的单个方向：主方向每步 ±1，次方向每步加一个定点增量
+// 位置用无符号 64 位按 2^64 取模累加，整数部分按 32 位补码解释，坐标接近 int 范围也不会溢出
+template <bool Steep, int MajorStep, typename Plot>
+inline void RasterizeLineFixedAxis(long long major, unsigned long long pos, unsigned long long inc, long long count, Plot& plot)
+{
+    for (long long i = 0; i < count; ++i) {
+        int minor = static_cast<int>(static_cast<unsigned int>(pos >> 32));
+        if constexpr (Steep)
+            plot(minor, static_cast<int>(major));
+        else
+            plot(static_cast<int>(major), minor);
+        major += MajorStep;
+        pos += inc;
+    }
+}
+
+// 32.32 定点 DDA：主方向每个整数位置上把理想直线四舍五入到最近的像素，两端点精确命中
+// 增量按四舍五入计算，累计误差不超过 steps / 2 个最低位（即 steps / 2^33 像素），
+// 只有离 0.5 极近的位置可能与精确取整不同；在整个 int 范围内终点都不会偏
+// [first, last] 为要输出的主方向步数范围，跳到 first 只需一次乘法，结果与逐步累加完全相同
+template <typename Plot>
+void RasterizeLineFixed(int x0, int y0, int x1, int y1, Plot& plot, long long first = 0, long long last = LLONG_MAX)
+{
+    long long dx = static_cast<long long>(x1) - x0;
+    long long dy = static_cast<long long>(y1) - y0;
+    bool is_steep = std::llabs(dy) > std::llabs(dx);
+    long long major0 = is_steep ? y0 : x0;
+    long long dmajor = is_steep ? dy : dx;
+    long long dminor = is_steep ? dx : dy;
+    int minor0 = is_steep ? x0 : y0;
+    unsigned long long steps = static_cast<unsigned long long>(std::llabs(dmajor));
+
+    first = std::max(first, 0LL);
+    last = std::min(last, static_cast<long long>(steps));
+    if (first > last)
+        return;
+
+    // |dminor| <= steps < 2^32，余数左移 32 位仍在 64 位以内
+    unsigned long long inc = 0;
+    if (steps > 0) {
+        unsigned long long magnitude = static_cast<unsigned long long>(std::llabs(dminor));
+        unsigned long long whole = magnitude / steps;
+        unsigned long long rem = magnitude % steps;
+        inc = (whole << 32) + ((rem << 32) + steps / 2) / steps;
+        if (dminor < 0)
+            inc = 0 - inc;
+    }
+
+    // 起点加 0.5 后取整数部分即为四舍五入
+    unsigned long long pos = (static_cast<unsigned long long>(static_cast<unsigned int>(minor0)) << 32) + (1ULL << 31);
+    pos += inc * static_cast<unsigned long long>(first);
+
+    long long count = last - first + 1;
+    if (dmajor >= 0) {
+        long long major = major0 + first;
+        if (is_steep)
+            RasterizeLineFixedAxis<true, 1>(major, pos, inc, count, plot);
+        else
+            RasterizeLineFixedAxis<false, 1>(major, pos, inc, count, plot);
+    } else {
+        long long major = major0 - first;
+        if (is_steep)
+            RasterizeLineFixedAxis<true, -1>(major, pos, inc, count, plot);
+        else
+            RasterizeLineFixedAxis<false, -1>(major, pos, inc, count, plot);
+    }
+}
+
+#endif // LINERASTERIZER_H
@@ -0,0 +1,401 @@
+#include "PolygonClip.h"
+#include <algorithm>
+#include <cmath>
+
+// 与 IsInside 相同的判断，边界编号在编译期确定
+template <int Edge>
+static inline bool InsideEdge(const ImVec2& point, const ClipWindow& clipWindow)
+{
+    switch (Edge) {
+    case 0: // 左边界
+        return point.x >= clipWindow.x0;
+    case 1: // 右边界
+        return point.x <= clipWindow.x1;
+    case 2: // 下边界
+        return point.y >= clipWindow.y0;
+    default: // 上边界
+        return point.y <= clipWindow.y1;
+    }
+}
+
+// 线段 p1p2 与边界的交点，计算方式与原来的实现相同
+template <int Edge>
+static inline ImVec2 IntersectEdge(const ImVec2& p1, const ImVec2& p2, const ClipWindow& clipWindow)
+{
+    switch (Edge) {
+    case 0:
+        return ImVec2(clipWindow.x0, p1.y + (p2.y - p1.y) * (clipWindow.x0 - p1.x) / (p2.x - p1.x));
+    case 1:
+        return ImVec2(clipWindow.x1, p1.y + (p2.y - p1.y) * (clipWindow.x1 - p1.x) / (p2.x - p1.x));
+    case 2:
+        return ImVec2(p1.x + (p2.x - p1.x) * (clipWindow.y0 - p1.y) / (p2.y - p1.y), clipWindow.y0);
+    default:
+        return ImVec2(p1.x + (p2.x - p1.x) * (clipWindow.y1 - p1.y) / (p2.y - p1.y), clipWindow.y1);
+    }
+}
+
+// 对一条边界裁剪 n 个顶点，结果写到 out 开头，返回结果的顶点数
+// 所有顶点都在内侧时结果就是输入，不复制，返回 -1
+template <int Edge>
+static int ClipStage(const ImVec2* in, int n, const ClipWindow& clipWindow, std::vector<ImVec2>& out)
+{
+    int inside = 0;
+    for (int i = 0; i < n; ++i)
+        inside += InsideEdge<Edge>(in[i], clipWindow) ? 1 : 0;
+    if (inside == n)
+        return -1;
+    if (inside == 0)
+        return 0;
+
+    // 每个内侧顶点输出一次；每次穿过边界多输出一个交点，进入和离开的次数都不超过内侧、外侧顶点数中较少的一个
+    const size_t bound = static_cast<size_t>(inside) + 2 * static_cast<size_t>(std::min(inside, n - inside));
+    if (out.size() < bound)
+        out.resize(bound);
+    ImVec2* dst = out.data();
+    int m = 0;
+    ImVec2 prev = in[n - 1];
+    bool prevInside = InsideEdge<Edge>(prev, clipWindow);
+    for (int i = 0; i < n; ++i) {
+        const ImVec2 cur = in[i];
+        const bool curInside = InsideEdge<Edge>(cur, clipWindow);
+        if (curInside) {
+            if (!prevInside)
+                dst[m++] = IntersectEdge<Edge>(prev, cur, clipWindow);
+            dst[m++] = cur;
+        } else if (prevInside) {
+            dst[m++] = IntersectEdge<Edge>(prev, cur, clipWindow);
+        }
+        prev = cur;
+        prevInside = curInside;
+    }
+    return m;
+}
+
+// 执行一步裁剪：结果写进 points 所在缓冲之外的另一个缓冲，points / n 改为指向结果；结果为空时返回 false
+template <int Edge>
+static bool RunStage(const ImVec2*& points, int& n, const ClipWindow& clipWindow, PolygonClipScratch& scratch)
+{
+    std::vector<ImVec2>& dst = points == scratch.ping.data() ? scratch.pong : scratch.ping;
+    const int m = ClipStage<Edge>(points, n, clipWindow, dst);
+    if (m >= 0) {
+        points = dst.data();
+        n = m;
+    }
+    return n > 0;
+}
+
+// 依次裁剪四条边界，result 指向结果（polygon 本身或 scratch 中的一个缓冲），返回顶点数
+static int ClipToScratch(const ImVec2* polygon,
+    int count,
+    const ClipWindow& clipWindow,
+    PolygonClipScratch& scratch,
+    const ImVec2*& result)
+{
+    result = polygon;
+    int n = count;
+    if (n <= 0)
+        return 0;
+    if (RunStage<0>(result, n, clipWindow, scratch)
+        && RunStage<1>(result, n, clipWindow, scratch)
+        && RunStage<2>(result, n, clipWindow, scratch)
+        && RunStage<3>(result, n, clipWindow, scratch))
+        return n;
+    return 0;
+}
+
+int ClipPolygonSutherlandHodgman(const ImVec2* polygon,
+    int count,
+    const ClipWindow& clipWindow,
+    std::vector<ImVec2>& out,
+    PolygonClipScratch& scratch)
+{
+    const ImVec2* result = nullptr;
+    const int n = ClipToScratch(polygon, count, clipWindow, scratch, result);
+    out.assign(result, result + n);
+    return n;
+}
+
+void ClipPolygonsSutherlandHodgman(const ImVec2* points,
+    const int* polygon_start,
+    int polygonCount,
+    const ClipWindow& clipWindow,
+    std::vector<ImVec2>& out_points,
+    std::vector<int>& out_start,
+    PolygonClipScratch& scratch)
+{
+    out_points.clear();
+    if (polygonCount > 0)
+        out_points.reserve(polygon_start[polygonCount] - polygon_start[0]);
+    out_start.resize(std::max(polygonCount, 0) + 1);
+    out_start[0] = 0;
+    for (int i = 0; i < polygonCount; ++i) {
+        const int first = polygon_start[i];
+        const ImVec2* result = nullptr;
+        const int n = ClipToScratch(points + first, polygon_start[i + 1] - first, clipWindow, scratch, result);
+        out_points.insert(out_points.end(), result, result + n);
+        out_start[i + 1] = static_cast<int>(out_points.size());
+    }
+}
+
+// p 相对有向边 a -> b 的方向：大于 0 时在左侧。用 double 计算，同一组点每次得到相同的结果
+static inline double Orient(const ImVec2& a, const ImVec2& b, const ImVec2& p)
+{
+    return (static_cast<double>(b.x) - a.x) * (static_cast<double>(p.y) - a.y)
+        - (static_cast<double>(b.y) - a.y) * (static_cast<double>(p.x) - a.x);
+}
+
+// 有向面积的两倍，与 Orient 的方向约定相同：大于 0 时内部在每条边的左侧
+static double SignedArea(const ImVec2* points, int count)
+{
+    double area = 0.0;
+    for (int i = 0, j = count - 1; i < count; j = i++)
+        area += static_cast<double>(points[j].x) * points[i].y - static_cast<double>(points[i].x) * points[j].y;
+    return area;
+}
+
+// 每条边的 y 范围，按 ymin 排序；有非有限坐标时返回 false
+static bool BuildEdgeSpans(const ImVec2* points, int count, std::vector<WeilerAthertonScratch::EdgeSpan>& spans)
+{
+    spans.resize(count);
+    for (int i = 0; i < count; ++i) {
+        const ImVec2& a = points[i];
+        const ImVec2& b = points[i + 1 == count ? 0 : i + 1];
+        if (!std::isfinite(a.x) || !std::isfinite(a.y))
+            return false;
+        spans[i] = { std::min(a.y, b.y), std::max(a.y, b.y), i };
+    }
+    std::sort(spans.begin(), spans.end(), [](const WeilerAthertonScratch::EdgeSpan& l, const WeilerAthertonScratch::EdgeSpan& r) {
+        return l.ymin < r.ymin;
+    });
+    return true;
+}
+
+// 符号扰动：把主多边形整体平移 ε v，v = (1, ε')，ε' 比 ε 更小。平移后两个多边形之间没有任何退化的位置关系，
+// Orient 为 0 时改看一阶项的符号，一阶项为 ε cross(w, v) = ε (-w.y + ε' w.x)，w 为边的方向
+// 返回 cross(to - from, v) 的符号，零向量返回 0
+static inline int ShiftSign(const ImVec2& from, const ImVec2& to)
+{
+    if (to.y != from.y)
+        return to.y > from.y ? -1 : 1;
+    return to.x > from.x ? 1 : (to.x < from.x ? -1 : 0);
+}
+
+// 平移后的点是否在多边形内（奇偶规则，数 +x 方向的射线穿过的边）
+// shift 为 1 时点平移 +ε v（主多边形的顶点），为 -1 时平移 -ε v（裁剪多边形的顶点相对主多边形）
+// 平移后点的 y 与任何顶点都不相同，也不会落在边上
+static bool ShiftedPointInPolygon(const ImVec2& p, int shift, const ImVec2* points, int count)
+{
+    bool inside = false;
+    for (int i = 0, j = count - 1; i < count; j = i++) {
+        const ImVec2& c = points[j];
+        const ImVec2& d = points[i];
+        const bool cBelow = shift > 0 ? c.y <= p.y : c.y < p.y;
+        const bool dBelow = shift > 0 ? d.y <= p.y : d.y < p.y;
+        if (cBelow == dBelow)
+            continue;
+        // 向上的边在点的右侧时点在边的左侧，向下的边相反
+        const double o = Orient(c, d, p);
+        const bool left = o > 0.0 || (o == 0.0 && shift * ShiftSign(c, d) > 0);
+        if (left != dBelow)
+            inside = !inside;
+    }
+    return inside;
+}
+
+// 求主多边形第 i 条边与裁剪多边形第 j 条边的交点，两个多边形上各加一个节点
+static void IntersectEdges(const ImVec2* subject,
+    int subjectCount,
+    int i,
+    const ImVec2* clip,
+    int clipCount,
+    int j,
+    bool clipCounterClockwise,
+    WeilerAthertonScratch& scratch)
+{
+    const ImVec2& a = subject[i];
+    const ImVec2& b = subject[i + 1 == subjectCount ? 0 : i + 1];
+    const ImVec2& c = clip[j];
+    const ImVec2& d = clip[j + 1 == clipCount ? 0 : j + 1];
+
+    // 平移后主多边形的端点在 c -> d 的哪一侧：Orient(c, d, a + ε v) = Orient(c, d, a) + ε cross(d - c, v)
+    const double oa = Orient(c, d, a);
+    const double ob = Orient(c, d, b);
+    const int shiftCD = ShiftSign(c, d);
+    const bool leftA = oa > 0.0 || (oa == 0.0 && shiftCD > 0);
+    const bool leftB = ob > 0.0 || (ob == 0.0 && shiftCD > 0);
+    if (leftA == leftB)
+        return;
+    // 裁剪多边形的端点在 a -> b 的哪一侧：Orient(a + ε v, b + ε v, c) = Orient(a, b, c) - ε cross(b - a, v)
+    const double oc = Orient(a, b, c);
+    const double od = Orient(a, b, d);
+    const int shiftAB = ShiftSign(a, b);
+    const bool leftC = oc > 0.0 || (oc == 0.0 && shiftAB < 0);
+    const bool leftD = od > 0.0 || (od == 0.0 && shiftAB < 0);
+    if (leftC == leftD)
+        return;
+
+    // 两侧不同时分子分母不会同时为 0；dt 为 t 对 ε、ε' 的一阶变化
+    const double subjectDenom = oa - ob;
+    const double clipDenom = oc - od;
+    const double t = oa / subjectDenom;
+    const double u = oc / clipDenom;
+    const ImVec2 point(a.x + (b.x - a.x) * static_cast<float>(t), a.y + (b.y - a.y) * static_cast<float>(t));
+    const int node = static_cast<int>(scratch.nodes.size());
+    // 平移后的终点 b 在裁剪多边形内侧时，沿主多边形前进经过这个交点进入裁剪多边形
+    const bool entering = leftB == clipCounterClockwise;
+    scratch.nodes.push_back({ point, -1, -1, node + 1, entering, false });
+    scratch.nodes.push_back({ point, -1, -1, node, false, false });
+    scratch.subject_crossings.push_back({ i, t, { -(static_cast<double>(d.y) - c.y) / subjectDenom, (static_cast<double>(d.x) - c.x) / subjectDenom }, node });
+    scratch.clip_crossings.push_back({ j, u, { (static_cast<double>(b.y) - a.y) / clipDenom, -(static_cast<double>(b.x) - a.x) / clipDenom }, node + 1 });
+}
+
+// 把一个多边形的顶点（节点 first 起的 count 个）和边上的交点连成双向循环链表
+static void LinkPolygon(int first, int count, std::vector<WeilerAthertonScratch::Crossing>& crossings, std::vector<WeilerAthertonScratch::Node>& nodes)
+{
+    std::sort(crossings.begin(), crossings.end(), [](const WeilerAthertonScratch::Crossing& l, const WeilerAthertonScratch::Crossing& r) {
+        if (l.edge != r.edge)
+            return l.edge < r.edge;
+        if (l.t != r.t)
+            return l.t < r.t;
+        if (l.dt[0] != r.dt[0])
+            return l.dt[0] < r.dt[0];
+        if (l.dt[1] != r.dt[1])
+            return l.dt[1] < r.dt[1];
+        return l.node < r.node;
+    });
+    size_t k = 0;
+    for (int i = 0; i < count; ++i) {
+        int prev = first + i;
+        for (; k < crossings.size() && crossings[k].edge == i; ++k) {
+            nodes[prev].next = crossings[k].node;
+            nodes[crossings[k].node].prev = prev;
+            prev = crossings[k].node;
+        }
+        const int next = first + (i + 1 == count ? 0 : i + 1);
+        nodes[prev].next = next;
+        nodes[next].prev = prev;
+    }
+}
+
+// 把一个多边形原样作为一个结果
+static void EmitPolygon(const ImVec2* points, int count, std::vector<ImVec2>& out_points, std::vector<int>& out_start)
+{
+    out_points.insert(out_points.end(), points, points + count);
+    out_start.push_back(static_cast<int>(out_points.size()));
+}
+
+int ClipPolygonWeilerAtherton(const ImVec2* subject,
+    int subjectCount,
+    const ImVec2* clip,
+    int clipCount,
+    std::vector<ImVec2>& out_points,
+    std::vector<int>& out_start,
+    WeilerAthertonScratch& scratch)
+{
+    out_points.clear();
+    out_start.assign(1, 0);
+    if (subjectCount < 3 || clipCount < 3)
+        return 0;
+    const double subjectArea = SignedArea(subject, subjectCount);
+    const double clipArea = SignedArea(clip, clipCount);
+    if (subjectArea == 0.0 || clipArea == 0.0)
+        return 0;
+    if (!BuildEdgeSpans(subject, subjectCount, scratch.subject_spans) || !BuildEdgeSpans(clip, clipCount, scratch.clip_spans))
+        return 0;
+
+    // 原来的顶点：主多边形在前，裁剪多边形在后
+    scratch.nodes.resize(subjectCount + clipCount);
+    for (int i = 0; i < subjectCount; ++i)
+        scratch.nodes[i] = { subject[i], -1, -1, -1, false, false };
+    for (int j = 0; j < clipCount; ++j)
+        scratch.nodes[subjectCount + j] = { clip[j], -1, -1, -1, false, false };
+    scratch.subject_crossings.clear();
+    scratch.clip_crossings.clear();
+
+    // 按 ymin 的顺序加入两边的边，新加入的边只与另一边仍然有效（ymax >= ymin）的边求交
+    const bool clipCounterClockwise = clipArea > 0.0;
+    const auto& subjectSpans = scratch.subject_spans;
+    const auto& clipSpans = scratch.clip_spans;
+    auto& activeSubject = scratch.active_subject;
+    auto& activeClip = scratch.active_clip;
+    activeSubject.clear();
+    activeClip.clear();
+    size_t si = 0, ci = 0;
+    while (si < subjectSpans.size() || ci < clipSpans.size()) {
+        if (ci == clipSpans.size() || (si < subjectSpans.size() && subjectSpans[si].ymin <= clipSpans[ci].ymin)) {
+            const WeilerAthertonScratch::EdgeSpan& span = subjectSpans[si];
+            for (size_t k = 0; k < activeClip.size();) {
+                const WeilerAthertonScratch::EdgeSpan& other = clipSpans[activeClip[k]];
+                if (other.ymax < span.ymin) {
+                    activeClip[k] = activeClip.back();
+                    activeClip.pop_back();
+                    continue;
+                }
+                IntersectEdges(subject, subjectCount, span.edge, clip, clipCount, other.edge, clipCounterClockwise, scratch);
+                ++k;
+            }
+            activeSubject.push_back(static_cast<int>(si++));
+        } else {
+            const WeilerAthertonScratch::EdgeSpan& span = clipSpans[ci];
+            for (size_t k = 0; k < activeSubject.size();) {
+                const WeilerAthertonScratch::EdgeSpan& other = subjectSpans[activeSubject[k]];
+                if (other.ymax < span.ymin) {
+                    activeSubject[k] = activeSubject.back();
+                    activeSubject.pop_back();
+                    continue;
+                }
+                IntersectEdges(subject, subjectCount, other.edge, clip, clipCount, span.edge, clipCounterClockwise, scratch);
+                ++k;
+            }
+            activeClip.push_back(static_cast<int>(ci++));
+        }
+    }
+
+    // 边界不相交：一个多边形完全在另一个里面，或者两者分离
+    if (scratch.subject_crossings.empty()) {
+        if (ShiftedPointInPolygon(subject[0], 1, clip, clipCount))
+            EmitPolygon(subject, subjectCount, out_points, out_start);
+        else if (ShiftedPointInPolygon(clip[0], -1, subject, subjectCount))
+            EmitPolygon(clip, clipCount, out_points, out_start);
+        return static_cast<int>(out_start.size()) - 1;
+    }
+
+    LinkPolygon(0, subjectCount, scratch.subject_crossings, scratch.nodes);
+    LinkPolygon(subjectCount, clipCount, scratch.clip_crossings, scratch.nodes);
+
+    // 从每个未访问的入点出发：沿主多边形前进到下一个交点，跳到裁剪多边形继续走到下一个交点，再跳回来，直到回到起点
+    // 两个多边形方向相反时，裁剪多边形反向遍历。每个节点最多经过一次，总步数不超过节点数
+    const bool clipForward = (subjectArea > 0.0) == clipCounterClockwise;
+    std::vector<WeilerAthertonScratch::Node>& nodes = scratch.nodes;
+    const int nodeCount = static_cast<int>(nodes.size());
+    for (int start = subjectCount + clipCount; start < nodeCount; start += 2) {
+        if (!nodes[start].entering || nodes[start].visited)
+            continue;
+        const size_t first = out_points.size();
+        int cur = start;
+        bool onSubject = true;
+        int steps = 0;
+        while (true) {
+            nodes[cur].visited = true;
+            nodes[nodes[cur].neighbor].visited = true;
+            out_points.push_back(nodes[cur].point);
+            int walk = (onSubject || clipForward) ? nodes[cur].next : nodes[cur].prev;
+            while (nodes[walk].neighbor < 0 && ++steps < nodeCount) {
+                out_points.push_back(nodes[walk].point);
+                walk = (onSubject || clipForward) ? nodes[walk].next : nodes[walk].prev;
+            }
+            // 退化的输入（例如自交）可能让入点、出点不交替出现，这时提前结束这个环
+            if (nodes[walk].neighbor < 0 || ++steps >= nodeCount)
+                break;
+            cur = nodes[walk].neighbor;
+            onSubject = !onSubject;
+            if (cur == start || nodes[cur].visited)
+                break;
+        }
+        if (out_points.size() - first >= 3)
+            out_start.push_back(static_cast<int>(out_points.size()));
+        else
+            out_points.resize(first);
+    }
+    return static_cast<int>(out_start.size()) - 1;
+}
@@ -0,0 +1,84 @@
+#ifndef POLYGONCLIP_H
+#define POLYGONCLIP_H
+
+#include "Algorithm.h"
+#include <vector>
+
+// Sutherland-Hodgman 裁剪的中间结果缓冲，多次调用之间复用
+// 四条边界依次裁剪，每一步的结果在 ping / pong 之间来回写，缓冲只在变长时重新分配
+struct PolygonClipScratch {
+    std::vector<ImVec2> ping;
+    std::vector<ImVec2> pong;
+};
+
+// 用 Sutherland-Hodgman 算法把多边形裁剪到 clipWindow，结果写入 out（先清空），返回结果的顶点数
+// 每条边界上所有顶点都在内侧时跳过这一步；某一步的结果为空时直接返回 0（包括 count <= 0）
+// 输出与 SutherlandHodgmanPolygonClip 完全相同；polygon 不能指向 out 或 scratch 中的缓冲
+int ClipPolygonSutherlandHodgman(const ImVec2* polygon,
+    int count,
+    const ClipWindow& clipWindow,
+    std::vector<ImVec2>& out,
+    PolygonClipScratch& scratch);
+
+// 批量裁剪：第 i 个多边形是 points 中下标 [polygon_start[i], polygon_start[i + 1]) 的顶点
+// 结果按同样的布局连续写入 out_points / out_start（先清空，out_start 共 polygonCount + 1 项）；
+// 被完全裁掉的多边形对应一个空区间
+void ClipPolygonsSutherlandHodgman(const ImVec2* points,
+    const int* polygon_start,
+    int polygonCount,
+    const ClipWindow& clipWindow,
+    std::vector<ImVec2>& out_points,
+    std::vector<int>& out_start,
+    PolygonClipScratch& scratch);
+
+// Weiler-Atherton 裁剪的工作缓冲，多次调用之间复用
+// 两个多边形的顶点和交点组成两条双向循环链表（下标链接，存放在同一个数组中），
+// 同一个交点在两条链表中各有一个节点，用 neighbor 互相链接；遍历时沿链表前进，在交点处直接跳到另一条链表
+struct WeilerAthertonScratch {
+    struct Node {
+        ImVec2 point;
+        int next, prev;
+        int neighbor; // 另一个多边形中的同一个交点；原来的顶点为 -1
+        bool entering; // 主多边形上的交点：沿主多边形前进时由此进入裁剪多边形
+        bool visited;
+    };
+
+    // 一条边上的交点：按 (edge, t) 排序后依次插入这条边的两个端点之间
+    // 几个交点的 t 恰好相同时（例如边经过另一个多边形的顶点），按扰动后 t 的变化率 dt 排序
+    struct Crossing {
+        int edge;
+        double t;
+        double dt[2];
+        int node;
+    };
+
+    // 扫描线求交时边的 y 范围
+    struct EdgeSpan {
+        float ymin, ymax;
+        int edge;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<Crossing> subject_crossings;
+    std::vector<Crossing> clip_crossings;
+    std::vector<EdgeSpan> subject_spans;
+    std::vector<EdgeSpan> clip_spans;
+    std::vector<int> active_subject;
+    std::vector<int> active_clip;
+};
+
+// 用 Weiler-Atherton 算法求主多边形 subject 与裁剪多边形 clip 的交（两者都是简单多边形，凹凸均可，方向任意）
+// 求交时按 y 范围扫描，只检查 y 范围重叠的边对；交点按边上的参数 t 排序插入链表，遍历为 O(n + m + k)
+// 顶点恰好落在另一个多边形的边上、边与边重合等退化情况按符号扰动处理（主多边形整体平移一个无穷小量），
+// 每个交叉只计一次，不会产生重复的交点
+// 边界没有交点时，结果为被另一个包含的那个多边形，或者为空
+// 结果按 ClipPolygonsSutherlandHodgman 的布局写入 out_points / out_start（先清空），返回结果的多边形数
+int ClipPolygonWeilerAtherton(const ImVec2* subject,
+    int subjectCount,
+    const ImVec2* clip,
+    int clipCount,
+    std::vector<ImVec2>& out_points,
+    std::vector<int>& out_start,
+    WeilerAthertonScratch& scratch);
+
+#endif // POLYGONCLIP_H
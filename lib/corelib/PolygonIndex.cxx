@@ -0,0 +1,247 @@
+#include "PolygonIndex.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// 自动选择时条带数的上限
+static constexpr int kMaxAutoSlabs = 1 << 16;
+
+// 自动选择条带数时，所有边登记的总次数大约不超过边数的这么多倍
+static constexpr int kAutoSlabBudget = 16;
+
+// 批量查询时每个任务处理的点数
+static constexpr int kBatchChunk = 1 << 16;
+
+PolygonIndex::PolygonIndex()
+    : ymin(0.0f)
+    , ymax(0.0f)
+    , slab_scale(0.0f)
+    , slab_count(0)
+{
+}
+
+// 把一条有向边加入 edges，忽略水平边
+static void AddIndexEdge(std::vector<PolygonIndex::Edge>& edges, float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1)
+        return;
+    int winding = 1;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        winding = -1;
+    }
+    edges.push_back({ x0, y0, (x1 - x0) / (y1 - y0), y1, winding });
+}
+
+void PolygonIndex::Build(const ImVec2* points, int count, int slabCount)
+{
+    std::vector<Edge> edges;
+    edges.reserve(count);
+    for (int i = 0; i < count && count >= 3; ++i) {
+        const ImVec2& a = points[i];
+        const ImVec2& b = points[(i + 1) == count ? 0 : i + 1];
+        AddIndexEdge(edges, a.x, a.y, b.x, b.y);
+    }
+    BuildEdges(edges, slabCount);
+}
+
+void PolygonIndex::Build(const float* x, const float* y, const int* contour_start, int contourCount, int slabCount)
+{
+    std::vector<Edge> edges;
+    edges.reserve(contourCount > 0 ? contour_start[contourCount] - contour_start[0] : 0);
+    for (int c = 0; c < contourCount; ++c) {
+        const int first = contour_start[c];
+        const int last = contour_start[c + 1];
+        for (int i = first; i < last && last - first >= 3; ++i) {
+            int next = (i + 1) == last ? first : i + 1;
+            AddIndexEdge(edges, x[i], y[i], x[next], y[next]);
+        }
+    }
+    BuildEdges(edges, slabCount);
+}
+
+int PolygonIndex::SlabOf(float y) const
+{
+    int slab = static_cast<int>((y - ymin) * slab_scale);
+    return std::min(std::max(slab, 0), slab_count - 1);
+}
+
+// 边与 y 的交点
+static inline float EdgeX(const PolygonIndex::Edge& edge, float y)
+{
+    return edge.x0 + edge.dx * (y - edge.y0);
+}
+
+void PolygonIndex::BuildEdges(const std::vector<Edge>& edges, int slabCount)
+{
+    slab_start.clear();
+    slab_sorted.clear();
+    slab_edges.clear();
+    slab_winding.clear();
+    slab_count = 0;
+    if (edges.empty())
+        return;
+
+    ymin = edges[0].y0;
+    ymax = edges[0].y1;
+    double height = 0.0;
+    for (const Edge& edge : edges) {
+        ymin = std::min(ymin, edge.y0);
+        ymax = std::max(ymax, edge.y1);
+        height += edge.y1 - edge.y0;
+    }
+    // 每条边登记的次数约为 1 + 高度 * 条带数 / 总高度，据此限制条带数
+    const int edgeCount = static_cast<int>(edges.size());
+    if (slabCount > 0) {
+        slab_count = slabCount;
+    } else {
+        double budget = static_cast<double>(kAutoSlabBudget) * edgeCount * (ymax - ymin) / height;
+        slab_count = static_cast<int>(std::min<double>(std::min(edgeCount, kMaxAutoSlabs), std::max(budget, 1.0)));
+    }
+    slab_scale = slab_count / (ymax - ymin);
+
+    // 两遍 CSR：先数每个条带的边数，再按前缀和写入
+    // 边在 [y0, y1) 内有效，SlabOf 单调，所以有效范围内的任意 y 都落在 [SlabOf(y0), SlabOf(y1)] 中；
+    // 对 SlabOf(y0) < s < SlabOf(y1) 的条带，条带内任意 y 都满足 y0 < y < y1，即边贯穿这个条带
+    slab_start.assign(slab_count + 1, 0);
+    slab_sorted.assign(slab_count, 0);
+    for (const Edge& edge : edges) {
+        const int first = SlabOf(edge.y0), last = SlabOf(edge.y1);
+        for (int s = first; s <= last; ++s) {
+            slab_start[s + 1]++;
+            if (s > first && s < last)
+                slab_sorted[s]++;
+        }
+    }
+    for (int s = 0; s < slab_count; ++s)
+        slab_start[s + 1] += slab_start[s];
+    slab_edges.resize(slab_start[slab_count]);
+    slab_winding.assign(slab_edges.size(), 0);
+
+    // 贯穿边放在条带开头，其余的边放在后面
+    std::vector<int> sortedCursor(slab_start.begin(), slab_start.end() - 1);
+    std::vector<int> partialCursor(slab_count);
+    for (int s = 0; s < slab_count; ++s)
+        partialCursor[s] = slab_start[s] + slab_sorted[s];
+    for (const Edge& edge : edges) {
+        const int first = SlabOf(edge.y0), last = SlabOf(edge.y1);
+        for (int s = first; s <= last; ++s) {
+            if (s > first && s < last)
+                slab_edges[sortedCursor[s]++] = edge;
+            else
+                slab_edges[partialCursor[s]++] = edge;
+        }
+    }
+
+    // 贯穿边按条带中线上的交点排序；在条带上下边界处顺序也要一致，否则（自交）退回逐条检查
+    for (int s = 0; s < slab_count; ++s) {
+        Edge* begin = slab_edges.data() + slab_start[s];
+        Edge* end = begin + slab_sorted[s];
+        const float top = ymin + s / slab_scale;
+        const float bottom = ymin + (s + 1) / slab_scale;
+        const float middle = 0.5f * (top + bottom);
+        std::sort(begin, end, [&](const Edge& a, const Edge& b) { return EdgeX(a, middle) < EdgeX(b, middle); });
+        bool ordered = true;
+        for (Edge* e = begin; e + 1 < end && ordered; ++e)
+            ordered = EdgeX(e[0], top) <= EdgeX(e[1], top) && EdgeX(e[0], bottom) <= EdgeX(e[1], bottom);
+        if (!ordered) {
+            slab_sorted[s] = 0;
+            continue;
+        }
+        int winding = 0;
+        for (int i = slab_start[s]; i < slab_start[s] + slab_sorted[s]; ++i) {
+            winding += slab_edges[i].winding;
+            slab_winding[i] = winding;
+        }
+    }
+}
+
+int PolygonIndex::Winding(float x, float y) const
+{
+    if (slab_count == 0 || !(y >= ymin && y < ymax))
+        return 0;
+    const int s = SlabOf(y);
+    const int first = slab_start[s];
+    const int sorted = first + slab_sorted[s];
+
+    // 贯穿边：二分查找第一条交点在 x 右侧的边
+    int lo = first, hi = sorted;
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        if (EdgeX(slab_edges[mid], y) <= x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    int winding = lo > first ? slab_winding[lo - 1] : 0;
+
+    // 在条带内开始或结束的边
+    for (int i = sorted; i < slab_start[s + 1]; ++i) {
+        const Edge& edge = slab_edges[i];
+        if (y >= edge.y0 && y < edge.y1 && EdgeX(edge, y) <= x)
+            winding += edge.winding;
+    }
+    return winding;
+}
+
+void PolygonIndex::ContainsBatch(const ImVec2* points, int count, uint8_t* inside, FillRule rule) const
+{
+    for (int i = 0; i < count; ++i)
+        inside[i] = Contains(points[i].x, points[i].y, rule) ? 1 : 0;
+}
+
+void PolygonIndex::ContainsBatch(const ImVec2* points, int count, uint8_t* inside, ThreadPool& pool, FillRule rule) const
+{
+    const int chunks = (count + kBatchChunk - 1) / kBatchChunk;
+    pool.ParallelFor(chunks, [&](int chunk) {
+        const int first = chunk * kBatchChunk;
+        ContainsBatch(points + first, std::min(kBatchChunk, count - first), inside + first, rule);
+    });
+}
+
+void PolygonIndex::RasterizeMask(int x0, int y0, int width, int height, uint8_t* mask, FillRule rule) const
+{
+    if (width <= 0 || height <= 0)
+        return;
+    std::memset(mask, 0, static_cast<size_t>(width) * height);
+    if (slab_count == 0)
+        return;
+
+    std::vector<std::pair<float, int>> crossings;
+    for (int row = 0; row < height; ++row) {
+        const float y = static_cast<float>(y0 + row);
+        if (!(y >= ymin && y < ymax))
+            continue;
+
+        // 这一行上各边的交点，按 x 排序：贯穿边已经有序，只需排序其余的边再归并
+        const int s = SlabOf(y);
+        const int sorted = slab_start[s] + slab_sorted[s];
+        crossings.clear();
+        for (int i = slab_start[s]; i < sorted; ++i)
+            crossings.emplace_back(EdgeX(slab_edges[i], y), slab_edges[i].winding);
+        const size_t partial = crossings.size();
+        for (int i = sorted; i < slab_start[s + 1]; ++i) {
+            const Edge& edge = slab_edges[i];
+            if (y >= edge.y0 && y < edge.y1)
+                crossings.emplace_back(EdgeX(edge, y), edge.winding);
+        }
+        std::sort(crossings.begin() + partial, crossings.end());
+        std::inplace_merge(crossings.begin(), crossings.begin() + partial, crossings.end());
+
+        // 交点 i 与 i + 1 之间的像素 ceil(xc_i) <= x < ceil(xc_{i+1}) 的环绕数相同
+        uint8_t* line = mask + static_cast<size_t>(row) * width;
+        const float right = static_cast<float>(x0 + width);
+        int winding = 0;
+        for (size_t i = 0; i + 1 < crossings.size(); ++i) {
+            winding += crossings[i].second;
+            if (rule == FILL_NONZERO ? winding == 0 : (winding & 1) == 0)
+                continue;
+            const float from = std::max(std::ceil(crossings[i].first), static_cast<float>(x0));
+            const float to = std::min(std::ceil(crossings[i + 1].first), right);
+            if (from < to)
+                std::memset(line + (static_cast<int>(from) - x0), 1, static_cast<size_t>(to - from));
+        }
+    }
+}
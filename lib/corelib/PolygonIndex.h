@@ -0,0 +1,64 @@
+#ifndef POLYGONINDEX_H
+#define POLYGONINDEX_H
+
+#include "ScanlineFill.h"
+#include <cstdint>
+#include <vector>
+
+struct ThreadPool;
+
+// 点在多边形内判断的索引：把包围盒按 y 均分成若干水平条带（slab），每条边登记到它经过的所有条带
+// 查询只检查点所在条带的边，而不是所有边：
+// - 贯穿整个条带的边在条带内互不相交，按 x 排好序并记下环绕数的前缀和，二分查找即可
+// - 只有在条带内开始或结束的边才逐条检查
+// 自交多边形中贯穿边的顺序在条带内可能改变，这样的条带退回逐条检查，结果仍然正确
+// 采样规则与 FillSceneTiled / FillPolygonEdgeFlag 相同：边在 y0 <= y < y1 的范围内有效，
+// 点按交点 xc <= x 的边计数，所以整数坐标上的查询结果与这两种填充的像素完全一致
+struct PolygonIndex {
+    // 一条边：(x0, y0) 为下端点，在 [y0, y1) 内有效
+    struct Edge {
+        float x0, y0, dx;
+        float y1;
+        int winding; // 原方向向下（y 增大）为 +1，否则为 -1
+    };
+
+    float ymin, ymax; // 所有边的 y 范围
+    float slab_scale; // 条带数 / 条带覆盖的高度
+    int slab_count;
+    std::vector<int> slab_start; // 第 s 个条带的边是 slab_edges[slab_start[s], slab_start[s + 1])
+    std::vector<int> slab_sorted; // 第 s 个条带开头按 x 排序的贯穿边数
+    std::vector<Edge> slab_edges;
+    std::vector<int> slab_winding; // 贯穿边从条带开头到这条边（含）的环绕数之和
+
+    PolygonIndex();
+
+    // 为多边形（可以有多个轮廓，contour_start 的含义与 FillScene 相同）建立索引
+    // slabCount 为 0 时按边数和边的高度自动选择，使登记的总次数不超过边数的若干倍
+    void Build(const ImVec2* points, int count, int slabCount = 0);
+    void Build(const float* x, const float* y, const int* contour_start, int contourCount, int slabCount = 0);
+
+    // 点 (x, y) 处的环绕数
+    int Winding(float x, float y) const;
+
+    bool Contains(float x, float y, FillRule rule = FILL_EVEN_ODD) const
+    {
+        int winding = Winding(x, y);
+        return rule == FILL_NONZERO ? winding != 0 : (winding & 1) != 0;
+    }
+
+    // 批量查询：inside[i] 为 points[i] 是否在内部（1 / 0）
+    void ContainsBatch(const ImVec2* points, int count, uint8_t* inside, FillRule rule = FILL_EVEN_ODD) const;
+
+    // 按块分给线程池并行查询，结果与串行版本相同
+    void ContainsBatch(const ImVec2* points, int count, uint8_t* inside, ThreadPool& pool, FillRule rule = FILL_EVEN_ODD) const;
+
+    // 对整数网格 [x0, x0 + width) x [y0, y0 + height) 生成掩码，mask 按行存放，每行 width 个字节
+    // 每行只求一次条带内各边的交点，再按交点顺序整段写入，比逐点查询快得多
+    void RasterizeMask(int x0, int y0, int width, int height, uint8_t* mask, FillRule rule = FILL_EVEN_ODD) const;
+
+private:
+    int SlabOf(float y) const;
+    void BuildEdges(const std::vector<Edge>& edges, int slabCount);
+};
+
+#endif // POLYGONINDEX_H
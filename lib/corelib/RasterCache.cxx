@@ -0,0 +1,209 @@
+#include "RasterCache.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace {
+
+// 键的 64 位 FNV-1a 哈希
+uint64_t HashBytes(const std::vector<uint8_t>& data)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (uint8_t byte : data) {
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// 记录算法输出的目标：像素照常转发给真正的目标，同时按段记下来
+struct SpanRecorder : RasterTarget {
+    struct Span {
+        int x0, x1, y;
+        ImU32 color;
+    };
+
+    RasterTarget& target;
+    std::vector<Span> spans;
+
+    explicit SpanRecorder(RasterTarget& target)
+        : target(target)
+    {
+    }
+
+    void Plot(int x, int y, ImU32 color) override
+    {
+        target.Plot(x, y, color);
+        spans.push_back({ x, x, y, color });
+    }
+
+    void PlotSpan(int x0, int x1, int y, ImU32 color) override
+    {
+        target.PlotSpan(x0, x1, y, color);
+        if (x0 <= x1)
+            spans.push_back({ x0, x1, y, color });
+    }
+
+    void PlotVSpan(int x, int y0, int y1, ImU32 color) override
+    {
+        target.PlotVSpan(x, y0, y1, color);
+        for (int y = y0; y <= y1; ++y)
+            spans.push_back({ x, x, y, color });
+    }
+
+    void Reserve(int pixel_count) override { target.Reserve(pixel_count); }
+
+    bool GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const override
+    {
+        return target.GetClipRect(xmin, ymin, xmax, ymax);
+    }
+};
+
+} // namespace
+
+RasterCache::RasterCache(size_t budget)
+    : budget(budget)
+    , hits(0)
+    , misses(0)
+    , bytes(0)
+{
+}
+
+void RasterCache::Clear()
+{
+    entries.clear();
+    lookup.clear();
+    bytes = 0;
+}
+
+size_t RasterCache::EntryBytes(const Entry& entry)
+{
+    return entry.params.size() + entry.spans.size() * sizeof(Span);
+}
+
+void RasterCache::BeginKey(const RasterTarget& target, int algorithm, ImU32 color)
+{
+    int clip[5] = { 0, 0, 0, 0, 0 };
+    clip[0] = target.GetClipRect(clip[1], clip[2], clip[3], clip[4]) ? 1 : 0;
+    key_bytes.clear();
+    AppendKey(&algorithm, sizeof(algorithm));
+    AppendKey(&color, sizeof(color));
+    AppendKey(clip, sizeof(clip));
+}
+
+void RasterCache::AppendKey(const void* data, size_t size)
+{
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    key_bytes.insert(key_bytes.end(), p, p + size);
+}
+
+bool RasterCache::Draw(RasterTarget& target,
+    int algorithm,
+    ImU32 color,
+    const void* params,
+    size_t size,
+    const std::function<void(RasterTarget&)>& rasterize)
+{
+    if (Bypass(target, rasterize))
+        return false;
+    BeginKey(target, algorithm, color);
+    AppendKey(params, size);
+    return Lookup(target, rasterize);
+}
+
+bool RasterCache::DrawPolygon(RasterTarget& target,
+    int algorithm,
+    ImU32 color,
+    const float* x,
+    const float* y,
+    int count,
+    const std::function<void(RasterTarget&)>& rasterize)
+{
+    if (Bypass(target, rasterize))
+        return false;
+    BeginKey(target, algorithm, color);
+    AppendKey(&count, sizeof(count));
+    AppendKey(x, static_cast<size_t>(std::max(count, 0)) * sizeof(float));
+    AppendKey(y, static_cast<size_t>(std::max(count, 0)) * sizeof(float));
+    return Lookup(target, rasterize);
+}
+
+bool RasterCache::Bypass(RasterTarget& target, const std::function<void(RasterTarget&)>& rasterize)
+{
+    // 用空范围询问：不会让 PixelCanvas 之类的目标记下改动区域
+    if (!target.AsPixelBuffer(0, 0, -1, -1))
+        return false;
+    rasterize(target);
+    return true;
+}
+
+bool RasterCache::Lookup(RasterTarget& target, const std::function<void(RasterTarget&)>& rasterize)
+{
+    const uint64_t key = HashBytes(key_bytes);
+    auto range = lookup.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& entry = *it->second;
+        if (entry.params.size() == key_bytes.size()
+            && std::memcmp(entry.params.data(), key_bytes.data(), key_bytes.size()) == 0) {
+            hits++;
+            entries.splice(entries.begin(), entries, it->second);
+            // 回放：单个像素仍然用 Plot，与算法原来的输出完全相同
+            for (const Span& span : entry.spans) {
+                const int px0 = entry.base_x + span.x0;
+                const int px1 = entry.base_x + span.x1;
+                const int py = entry.base_y + span.y;
+                if (px0 == px1)
+                    target.Plot(px0, py, span.color);
+                else
+                    target.PlotSpan(px0, px1, py, span.color);
+            }
+            return true;
+        }
+    }
+
+    misses++;
+    SpanRecorder recorder(target);
+    rasterize(recorder);
+
+    // 相对坐标存成 int16，范围太大或超过预算的结果不缓存
+    int xmin = INT_MAX, ymin = INT_MAX, xmax = INT_MIN, ymax = INT_MIN;
+    for (const SpanRecorder::Span& span : recorder.spans) {
+        xmin = std::min(xmin, span.x0);
+        xmax = std::max(xmax, span.x1);
+        ymin = std::min(ymin, span.y);
+        ymax = std::max(ymax, span.y);
+    }
+    if (!recorder.spans.empty()
+        && (static_cast<long long>(xmax) - xmin > INT16_MAX || static_cast<long long>(ymax) - ymin > INT16_MAX))
+        return false;
+    const size_t size = key_bytes.size() + recorder.spans.size() * sizeof(Span);
+    if (size > budget)
+        return false;
+
+    // 淘汰最久未使用的条目，直到放得下
+    while (!entries.empty() && bytes + size > budget) {
+        const Entry& last = entries.back();
+        bytes -= EntryBytes(last);
+        auto victims = lookup.equal_range(last.key);
+        for (auto it = victims.first; it != victims.second; ++it) {
+            if (it->second == std::prev(entries.end())) {
+                lookup.erase(it);
+                break;
+            }
+        }
+        entries.pop_back();
+    }
+
+    entries.push_front(Entry { key, key_bytes, xmin, ymin, {} });
+    Entry& entry = entries.front();
+    entry.spans.reserve(recorder.spans.size());
+    for (const SpanRecorder::Span& span : recorder.spans) {
+        entry.spans.push_back({ static_cast<int16_t>(span.x0 - xmin),
+            static_cast<int16_t>(span.x1 - xmin),
+            static_cast<int16_t>(span.y - ymin),
+            span.color });
+    }
+    lookup.emplace(key, entries.begin());
+    bytes += size;
+    return false;
+}
@@ -0,0 +1,92 @@
+#ifndef RASTERCACHE_H
+#define RASTERCACHE_H
+
+#include "RasterTarget.h"
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// 缓存键中的算法编号：同样的参数用不同的算法光栅化，结果不同
+enum RasterAlgorithm {
+    RASTER_ORDERED_EDGE_TABLE = 0,
+    RASTER_EDGE_FLAG = 1,
+    RASTER_COVERAGE = 2,
+    RASTER_SCENE = 3,
+    RASTER_USER = 256 // 调用方自定义的算法从这里开始编号
+};
+
+// 光栅化结果的缓存（LRU，容量按字节数限制）
+// 键为 (算法, 参数, 颜色, 目标的可见范围)：第一次绘制时照常运行算法，同时记录它输出的所有水平段；
+// 之后参数不变就直接回放这些段，不再运行算法
+// 段坐标相对结果的左上角存成 int16。像素坐标本来就相对画布原点，画布移动时由目标的 origin 平移，
+// 原点只通过可见范围影响结果，所以可见范围不变时仍然命中
+// 比较的是参数的全部字节，哈希冲突不会得到错误的结果
+// 只缓存通过 Plot / PlotSpan / PlotVSpan 接收像素的目标（例如 DrawListTarget），回放与直接绘制完全相同；
+// 能给出 PixelBuffer 的目标（见 AsPixelBuffer）上算法会直接读写内存，覆盖率和半透明颜色与原像素混合，
+// 记录的段无法重现这些结果，所以这类目标不经过缓存，直接运行算法，也不计入 hits / misses
+struct RasterCache {
+    size_t budget; // 最多占用的字节数
+    size_t hits;
+    size_t misses;
+
+    explicit RasterCache(size_t budget = 4 << 20);
+
+    // 命中时把记录的段回放到 target 并返回 true；否则调用 rasterize 画到 target 并记录结果，返回 false
+    // target 能给出 PixelBuffer 时直接调用 rasterize，返回 false
+    // params 为除颜色外决定结果的全部参数（顶点、半径等）
+    bool Draw(RasterTarget& target,
+        int algorithm,
+        ImU32 color,
+        const void* params,
+        size_t size,
+        const std::function<void(RasterTarget&)>& rasterize);
+
+    // 多边形：参数为 x、y 两个坐标数组
+    bool DrawPolygon(RasterTarget& target,
+        int algorithm,
+        ImU32 color,
+        const float* x,
+        const float* y,
+        int count,
+        const std::function<void(RasterTarget&)>& rasterize);
+
+    size_t EntryCount() const { return entries.size(); }
+
+    // 键和段占用的字节数（不含容器自身的开销）
+    size_t MemoryBytes() const { return bytes; }
+
+    double HitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses); }
+
+    void Clear();
+
+private:
+    // 一段像素 [x0, x1] x {y}，坐标相对条目的 (base_x, base_y)
+    struct Span {
+        int16_t x0, x1, y;
+        ImU32 color;
+    };
+
+    struct Entry {
+        uint64_t key;
+        std::vector<uint8_t> params; // 完整的键，用于确认命中
+        int base_x, base_y;
+        std::vector<Span> spans;
+    };
+
+    std::list<Entry> entries; // 最近使用的在前
+    std::unordered_multimap<uint64_t, std::list<Entry>::iterator> lookup;
+    size_t bytes;
+    std::vector<uint8_t> key_bytes; // 正在查询的键
+
+    // key_bytes 开头写入算法、颜色和目标的可见范围
+    void BeginKey(const RasterTarget& target, int algorithm, ImU32 color);
+    void AppendKey(const void* data, size_t size);
+    // target 能给出 PixelBuffer 时直接画到 target 并返回 true
+    static bool Bypass(RasterTarget& target, const std::function<void(RasterTarget&)>& rasterize);
+    bool Lookup(RasterTarget& target, const std::function<void(RasterTarget&)>& rasterize);
+    static size_t EntryBytes(const Entry& entry);
+};
+
+#endif // RASTERCACHE_H
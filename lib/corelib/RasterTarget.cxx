@@ -0,0 +1,163 @@
+#include "RasterTarget.h"
+#include <algorithm>
+#include <cmath>
+
+void RasterTarget::PlotSpan(int x0, int x1, int y, ImU32 color)
+{
+    for (int x = x0; x <= x1; ++x) {
+        Plot(x, y, color);
+    }
+}
+
+void RasterTarget::PlotVSpan(int x, int y0, int y1, ImU32 color)
+{
+    for (int y = y0; y <= y1; ++y) {
+        Plot(x, y, color);
+    }
+}
+
+DrawListTarget::DrawListTarget(ImDrawList* list, ImVec2 origin, float radius, PixelStyle style)
+    : draw_list(list)
+    , origin(origin)
+    , radius(radius)
+    , style(style)
+{
+}
+
+// 容量不够时按倍数增长（而不是恰好扩到 size），连续的小提示不会每次都重新分配
+template <typename T>
+static void GrowCapacity(ImVector<T>& v, int size)
+{
+    if (size > v.Capacity)
+        v.reserve(v._grow_capacity(size));
+}
+
+// 只扩大顶点和索引缓冲的容量，不改变绘制命令；提示偏大时只是多占一些内存
+void DrawListTarget::Reserve(int pixel_count)
+{
+    if (style != PIXEL_QUAD || pixel_count <= 0)
+        return;
+    const int quads = std::min(pixel_count, kMaxReserveQuads);
+    GrowCapacity(draw_list->VtxBuffer, draw_list->VtxBuffer.Size + quads * 4);
+    GrowCapacity(draw_list->IdxBuffer, draw_list->IdxBuffer.Size + quads * 6);
+}
+
+// 每个四边形单独 PrimReserve 后立即写满，绘制命令中不会留下没有写入的索引
+// 缓冲容量由 Reserve 提示预先扩大，没有提示时 ImVector 按倍数增长，重新分配的次数仍然只与总数的对数成正比
+void DrawListTarget::EmitQuad(const ImVec2& a, const ImVec2& b, ImU32 color)
+{
+    draw_list->PrimReserve(6, 4);
+    draw_list->PrimRect(a, b, color);
+}
+
+bool GetDrawListClipRect(const ImDrawList* draw_list, ImVec2 origin, float radius, int& xmin, int& ymin, int& xmax, int& ymax)
+{
+    // 还没有压入过裁剪矩形时不限制
+    if (draw_list->_ClipRectStack.Size == 0)
+        return false;
+    // 限制在 int 范围内，避免超大裁剪矩形转换溢出
+    auto to_int = [](float v) { return static_cast<int>(std::max(-1.0e9f, std::min(1.0e9f, v))); };
+    ImVec2 clip_min = draw_list->GetClipRectMin();
+    ImVec2 clip_max = draw_list->GetClipRectMax();
+    xmin = to_int(std::floor(clip_min.x - origin.x - radius));
+    ymin = to_int(std::floor(clip_min.y - origin.y - radius));
+    xmax = to_int(std::ceil(clip_max.x - origin.x + radius));
+    ymax = to_int(std::ceil(clip_max.y - origin.y + radius));
+    return true;
+}
+
+bool DrawListTarget::GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const
+{
+    return GetDrawListClipRect(draw_list, origin, radius, xmin, ymin, xmax, ymax);
+}
+
+void DrawListTarget::Plot(int x, int y, ImU32 color)
+{
+    float px = origin.x + x;
+    float py = origin.y + y;
+    if (style == PIXEL_QUAD)
+        EmitQuad(ImVec2(px - radius, py - radius), ImVec2(px + radius, py + radius), color);
+    else
+        draw_list->AddCircleFilled(ImVec2(px, py), radius, color);
+}
+
+void DrawListTarget::PlotSpan(int x0, int x1, int y, ImU32 color)
+{
+    float py = origin.y + y;
+    if (style == PIXEL_QUAD) {
+        EmitQuad(ImVec2(origin.x + x0 - radius, py - radius), ImVec2(origin.x + x1 + radius, py + radius), color);
+    } else {
+        // 一排圆点连成两端为半圆的长条，用圆角矩形一次画出，外形与逐像素画圆相同
+        draw_list->AddRectFilled(ImVec2(origin.x + x0 - radius, py - radius), ImVec2(origin.x + x1 + radius, py + radius), color, radius);
+    }
+}
+
+void DrawListTarget::PlotVSpan(int x, int y0, int y1, ImU32 color)
+{
+    float px = origin.x + x;
+    if (style == PIXEL_QUAD) {
+        EmitQuad(ImVec2(px - radius, origin.y + y0 - radius), ImVec2(px + radius, origin.y + y1 + radius), color);
+    } else {
+        draw_list->AddRectFilled(ImVec2(px - radius, origin.y + y0 - radius), ImVec2(px + radius, origin.y + y1 + radius), color, radius);
+    }
+}
+
+PixelBuffer::PixelBuffer(int width, int height)
+    : width(0)
+    , height(0)
+{
+    Resize(width, height);
+}
+
+void PixelBuffer::Resize(int w, int h)
+{
+    width = std::max(0, w);
+    height = std::max(0, h);
+    pixels.assign(static_cast<size_t>(width) * height, 0);
+}
+
+void PixelBuffer::Clear(ImU32 color)
+{
+    std::fill(pixels.begin(), pixels.end(), color);
+}
+
+void PixelBuffer::Plot(int x, int y, ImU32 color)
+{
+    if (Contains(x, y))
+        pixels[y * width + x] = color;
+}
+
+bool PixelBuffer::GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const
+{
+    xmin = 0;
+    ymin = 0;
+    xmax = width - 1;
+    ymax = height - 1;
+    return true;
+}
+
+void PixelBuffer::PlotSpan(int x0, int x1, int y, ImU32 color)
+{
+    if (y < 0 || y >= height)
+        return;
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, width - 1);
+    if (x0 > x1)
+        return;
+    ImU32* row = pixels.data() + static_cast<size_t>(y) * width;
+    std::fill(row + x0, row + x1 + 1, color);
+}
+
+void PixelBuffer::PlotVSpan(int x, int y0, int y1, ImU32 color)
+{
+    if (x < 0 || x >= width)
+        return;
+    y0 = std::max(y0, 0);
+    y1 = std::min(y1, height - 1);
+    if (y0 > y1)
+        return;
+    ImU32* p = pixels.data() + static_cast<size_t>(y0) * width + x;
+    for (int y = y0; y <= y1; ++y, p += width) {
+        *p = color;
+    }
+}
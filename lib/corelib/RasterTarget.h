@@ -0,0 +1,96 @@
+#ifndef RASTERTARGET_H
+#define RASTERTARGET_H
+
+#include "imgui.h"
+#include <vector>
+
+// 像素点的绘制方式
+enum PixelStyle {
+    PIXEL_CIRCLE = 0, // 每个像素调用一次 AddCircleFilled（逐个细分圆，顶点多）
+    PIXEL_QUAD = 1 // 四边形模式：每个像素直接写入一个四边形，不细分路径
+};
+
+// 像素坐标
+struct PixelCoord {
+    int x, y;
+};
+
+struct PixelBuffer;
+
+// 光栅化输出目标
+// 算法只负责计算出要点亮的像素，由目标决定像素最终写到哪里
+struct RasterTarget {
+    virtual ~RasterTarget() = default;
+
+    // 绘制单个像素
+    virtual void Plot(int x, int y, ImU32 color) = 0;
+
+    // 绘制一段水平像素 [x0, x1]（包含两端），默认逐像素绘制
+    virtual void PlotSpan(int x0, int x1, int y, ImU32 color);
+
+    // 绘制一段竖直像素 [y0, y1]（包含两端），默认逐像素绘制
+    virtual void PlotVSpan(int x, int y0, int y1, ImU32 color);
+
+    // 提示接下来大约要绘制多少个像素，便于提前预留空间
+    virtual void Reserve(int /*pixel_count*/) { }
+
+    // 可见像素的范围 [xmin, xmax] x [ymin, ymax]（包含两端），返回 false 表示不限制
+    // 算法可以据此跳过画布外的像素，范围外的像素即使画了也不会显示
+    virtual bool GetClipRect(int& /*xmin*/, int& /*ymin*/, int& /*xmax*/, int& /*ymax*/) const { return false; }
+
+    // 像素实际存放在一块 PixelBuffer 中时返回它，算法可以跳过虚函数直接写内存；默认返回 nullptr
+    // 调用者只会写 [x0, x1] x [y0, y1]（包含两端）内的像素，需要跟踪改动区域的目标据此记录
+    virtual PixelBuffer* AsPixelBuffer(int /*x0*/, int /*y0*/, int /*x1*/, int /*y1*/) { return nullptr; }
+};
+
+// ImDrawList 当前裁剪矩形对应的像素范围（像素坐标相对 origin，每个像素向外延伸 radius）
+bool GetDrawListClipRect(const ImDrawList* draw_list, ImVec2 origin, float radius, int& xmin, int& ymin, int& xmax, int& ymax);
+
+// 输出到 ImDrawList：每个像素一个圆点或一个四边形
+struct DrawListTarget : RasterTarget {
+    ImDrawList* draw_list;
+    ImVec2 origin; // 像素坐标的原点（通常是画布左上角）
+    float radius; // 像素点的半径
+    PixelStyle style;
+
+    DrawListTarget(ImDrawList* list, ImVec2 origin = ImVec2(0.0f, 0.0f), float radius = 1.0f, PixelStyle style = PIXEL_CIRCLE);
+
+    void Plot(int x, int y, ImU32 color) override;
+    void PlotSpan(int x0, int x1, int y, ImU32 color) override;
+    void PlotVSpan(int x, int y0, int y1, ImU32 color) override;
+    // 四边形模式下按提示预先扩大缓冲容量；不预留索引，每次绘制调用返回时 draw_list 都处于完整状态，
+    // 所以目标存活期间可以在同一个 draw_list 上画别的图元或切换裁剪矩形
+    void Reserve(int pixel_count) override;
+    bool GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const override;
+
+private:
+    // 一次提示最多预留的四边形数，避免超大的估计值一次申请过多内存
+    static constexpr int kMaxReserveQuads = 1 << 16;
+
+    void EmitQuad(const ImVec2& a, const ImVec2& b, ImU32 color);
+};
+
+// CPU 上的 RGBA8 帧缓冲，不依赖 OpenGL 上下文，可以在没有显示器的机器上使用
+// 像素按 ImU32 存储，内存中的字节顺序即 R、G、B、A
+struct PixelBuffer : RasterTarget {
+    int width;
+    int height;
+    std::vector<ImU32> pixels;
+
+    PixelBuffer(int width = 0, int height = 0);
+
+    void Resize(int width, int height);
+    void Clear(ImU32 color = 0);
+
+    ImU32 GetPixel(int x, int y) const { return pixels[y * width + x]; }
+    bool Contains(int x, int y) const { return x >= 0 && y >= 0 && x < width && y < height; }
+
+    // 超出缓冲区范围的像素直接丢弃
+    void Plot(int x, int y, ImU32 color) override;
+    void PlotSpan(int x0, int x1, int y, ImU32 color) override;
+    void PlotVSpan(int x, int y0, int y1, ImU32 color) override;
+    bool GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const override;
+    PixelBuffer* AsPixelBuffer(int /*x0*/, int /*y0*/, int /*x1*/, int /*y1*/) override { return this; }
+};
+
+#endif // RASTERTARGET_H
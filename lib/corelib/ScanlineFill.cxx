@@ -0,0 +1,505 @@
+#include "ScanlineFill.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// 边的标记：低位为方向（原方向向上，即 y 减小时为 1），第二位为非零规则，其余为填充 ID
+static inline int EdgeTag(int fill, bool nonzero, bool upward) { return fill * 4 + (nonzero ? 2 : 0) + (upward ? 1 : 0); }
+
+// 构建 CSR 边表：先统计每个桶的边数，前缀和得到桶的起点，再把边按桶写入
+// 每条轮廓都是闭合的，边的处理规则（忽略水平边、局部极值顶点只算一次）与 DrawPolygonWithOrderedEdgeTable 相同
+// contourStart 为 contourCount + 1 个顶点下标，fills 为空时所有边的填充 ID 为 0
+static int BuildEdgeTable(const float* x,
+    const float* y,
+    const int* contourStart,
+    const int* contourFill,
+    const FillScene::Fill* fills,
+    int contourCount,
+    int ymin,
+    int rows,
+    ScanlineScratch& s)
+{
+    const int vertexCount = contourStart[contourCount];
+    s.bucket_start.assign(rows + 1, 0);
+    s.edge_x.resize(vertexCount);
+    s.edge_dx.resize(vertexCount);
+    s.edge_ymax.resize(vertexCount);
+    s.edge_tag.resize(vertexCount);
+    s.edge_bucket.resize(vertexCount);
+
+    int edgeCount = 0;
+    for (int c = 0; c < contourCount; ++c) {
+        const int first = contourStart[c];
+        const int last = contourStart[c + 1];
+        const int fill = fills ? contourFill[c] : 0;
+        const bool nonzero = fills && fills[fill].rule == FILL_NONZERO;
+        if (last - first < 3)
+            continue; // 至少需要 3 个顶点
+
+        for (int i = first; i < last; ++i) {
+            int next = (i + 1) == last ? first : i + 1;
+            float x0f = x[i];
+            float y0f = y[i];
+            float x1f = x[next];
+            float y1f = y[next];
+
+            // 忽略水平边
+            if (y0f == y1f)
+                continue;
+
+            // 确保 y0 < y1
+            bool upward = y0f > y1f;
+            if (upward) {
+                std::swap(x0f, x1f);
+                std::swap(y0f, y1f);
+            }
+
+            float dx = (x1f - x0f) / (y1f - y0f);
+            if (std::ceil(y0f) == std::floor(y1f)) {
+                y1f -= 1.0f; // 让上端点不包含在当前边
+            }
+
+            int bucket = static_cast<int>(std::floor(y0f)) - ymin;
+            s.edge_x[edgeCount] = x0f;
+            s.edge_dx[edgeCount] = dx;
+            s.edge_ymax[edgeCount] = static_cast<int>(std::ceil(y1f));
+            s.edge_tag[edgeCount] = EdgeTag(fill, nonzero, upward);
+            s.edge_bucket[edgeCount] = bucket;
+            s.bucket_start[bucket + 1]++;
+            edgeCount++;
+        }
+    }
+
+    for (int r = 0; r < rows; ++r) {
+        s.bucket_start[r + 1] += s.bucket_start[r];
+    }
+
+    // 按桶重排：借用合并缓冲作为目标，再交换回来
+    s.merge_x.resize(edgeCount);
+    s.merge_dx.resize(edgeCount);
+    s.merge_ymax.resize(edgeCount);
+    s.merge_tag.resize(edgeCount);
+    s.order.assign(s.bucket_start.begin(), s.bucket_start.end() - 1); // 每个桶的写入位置
+    for (int e = 0; e < edgeCount; ++e) {
+        int slot = s.order[s.edge_bucket[e]]++;
+        s.merge_x[slot] = s.edge_x[e];
+        s.merge_dx[slot] = s.edge_dx[e];
+        s.merge_ymax[slot] = s.edge_ymax[e];
+        s.merge_tag[slot] = s.edge_tag[e];
+    }
+    s.edge_x.swap(s.merge_x);
+    s.edge_dx.swap(s.merge_dx);
+    s.edge_ymax.swap(s.merge_ymax);
+    s.edge_tag.swap(s.merge_tag);
+    return edgeCount;
+}
+
+template <typename T>
+static void GrowTo(std::vector<T>& v, int size)
+{
+    if (static_cast<int>(v.size()) < size)
+        v.resize(size);
+}
+
+// 活动边表和合并缓冲至少能放下 capacity 条边（构建边表时会和合并缓冲交换，所以逐个检查）
+static void ReserveActiveEdges(ScanlineScratch& s, int capacity)
+{
+    GrowTo(s.aet_x, capacity);
+    GrowTo(s.aet_dx, capacity);
+    GrowTo(s.aet_ymax, capacity);
+    GrowTo(s.aet_tag, capacity);
+    GrowTo(s.merge_x, capacity);
+    GrowTo(s.merge_dx, capacity);
+    GrowTo(s.merge_ymax, capacity);
+    GrowTo(s.merge_tag, capacity);
+    GrowTo(s.order, capacity);
+}
+
+// 在 [rowBegin, rowEnd] 上逐扫描线维护活动边表，每条扫描线调用 emit(scanLine, x, tag, active)
+// table 为从 ymin 开始分桶的边表，s 的 AET 中已有 active 条按 x 排好序的边（rowBegin 之前开始的边）
+// emit 看到的 AET 按 x 有序，x 为边与这条扫描线的交点；emit 之后再更新 x
+// table 和 s 可以是同一个对象：这里只读边表，只写 AET
+template <typename EmitRow>
+static void SweepEdgeTable(const ScanlineScratch& table, ScanlineScratch& s, int ymin, int rowBegin, int rowEnd, int active, EmitRow&& emit)
+{
+    // AET 中的边数不会超过已有的边加上这些扫描线开始的边
+    ReserveActiveEdges(s, active + table.bucket_start[rowEnd - ymin + 1] - table.bucket_start[rowBegin - ymin]);
+
+    float* ax = s.aet_x.data();
+    float* adx = s.aet_dx.data();
+    int* aymax = s.aet_ymax.data();
+    int* atag = s.aet_tag.data();
+
+    for (int scanLine = rowBegin; scanLine <= rowEnd; ++scanLine) {
+        // 移除 ymax <= scanLine 的边，保持剩余边的顺序
+        int kept = 0;
+        for (int i = 0; i < active; ++i) {
+            if (aymax[i] > scanLine) {
+                ax[kept] = ax[i];
+                adx[kept] = adx[i];
+                aymax[kept] = aymax[i];
+                atag[kept] = atag[i];
+                kept++;
+            }
+        }
+        active = kept;
+
+        // 把这条扫描线开始的边按 x 排序后合并进 AET
+        int begin = table.bucket_start[scanLine - ymin];
+        int end = table.bucket_start[scanLine - ymin + 1];
+        int added = 0;
+        for (int e = begin; e < end; ++e) {
+            if (table.edge_ymax[e] > scanLine)
+                s.order[added++] = e;
+        }
+        if (added > 0) {
+            const float* ex = table.edge_x.data();
+            std::sort(s.order.begin(), s.order.begin() + added, [ex](int a, int b) { return ex[a] < ex[b]; });
+
+            float* mx = s.merge_x.data();
+            float* mdx = s.merge_dx.data();
+            int* mymax = s.merge_ymax.data();
+            int* mtag = s.merge_tag.data();
+            int i = 0, j = 0, out = 0;
+            while (i < active || j < added) {
+                if (j == added || (i < active && !(ex[s.order[j]] < ax[i]))) {
+                    mx[out] = ax[i];
+                    mdx[out] = adx[i];
+                    mymax[out] = aymax[i];
+                    mtag[out] = atag[i];
+                    i++;
+                } else {
+                    int e = s.order[j++];
+                    mx[out] = table.edge_x[e];
+                    mdx[out] = table.edge_dx[e];
+                    mymax[out] = table.edge_ymax[e];
+                    mtag[out] = table.edge_tag[e];
+                }
+                out++;
+            }
+            active = out;
+            s.aet_x.swap(s.merge_x);
+            s.aet_dx.swap(s.merge_dx);
+            s.aet_ymax.swap(s.merge_ymax);
+            s.aet_tag.swap(s.merge_tag);
+            ax = s.aet_x.data();
+            adx = s.aet_dx.data();
+            aymax = s.aet_ymax.data();
+            atag = s.aet_tag.data();
+        }
+
+        emit(scanLine, static_cast<const float*>(ax), static_cast<const int*>(atag), active);
+
+        // 更新所有活动边的 x
+        for (int i = 0; i < active; ++i) {
+            ax[i] += adx[i];
+        }
+
+        // 相交的边交换了顺序，用插入排序恢复有序（通常一次比较都不需要移动）
+        for (int i = 1; i < active; ++i) {
+            if (!(ax[i] < ax[i - 1]))
+                continue;
+            float kx = ax[i];
+            float kdx = adx[i];
+            int kymax = aymax[i];
+            int ktag = atag[i];
+            int j = i;
+            while (j > 0 && kx < ax[j - 1]) {
+                ax[j] = ax[j - 1];
+                adx[j] = adx[j - 1];
+                aymax[j] = aymax[j - 1];
+                atag[j] = atag[j - 1];
+                j--;
+            }
+            ax[j] = kx;
+            adx[j] = kdx;
+            aymax[j] = kymax;
+            atag[j] = ktag;
+        }
+    }
+}
+
+void FillPolygonScanline(RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    ScanlineScratch& s)
+{
+    if (vertexCount < 3)
+        return; // 至少需要 3 个顶点
+
+    int ymin = std::numeric_limits<int>::max();
+    int ymax = std::numeric_limits<int>::min();
+    for (int i = 0; i < vertexCount; ++i) {
+        ymin = std::min(ymin, static_cast<int>(std::floor(y[i])));
+        ymax = std::max(ymax, static_cast<int>(std::ceil(y[i])));
+    }
+    const int rows = ymax - ymin + 1;
+    const int contourStart[2] = { 0, vertexCount };
+    BuildEdgeTable(x, y, contourStart, nullptr, nullptr, 1, ymin, rows, s);
+
+    SweepEdgeTable(s, s, ymin, ymin, ymax, 0, [&](int scanLine, const float* ax, const int*, int active) {
+        // 使用奇偶规则绘制扫描线
+        for (int i = 0; i + 1 < active; i += 2) {
+            int pixelStart = static_cast<int>(std::ceil(ax[i]));
+            int pixelEnd = static_cast<int>(std::floor(ax[i + 1]));
+            if (pixelEnd >= pixelStart) {
+                target.PlotSpan(pixelStart, pixelEnd, scanLine, color);
+            }
+        }
+    });
+}
+
+// 在 row 行开始时恢复 AET：找出 row 之前开始、仍然有效的边，按串行扫描相同的顺序逐行累加 x
+// 这样 x 与串行扫描到 row 时逐位相同；边最多跨越 maxEdgeRows 行，只需检查这么多个桶
+static int SeedActiveEdges(const ScanlineScratch& table, ScanlineScratch& s, int ymin, int row, int maxEdgeRows)
+{
+    const int firstRow = std::max(ymin, row - maxEdgeRows);
+    ReserveActiveEdges(s, table.bucket_start[row - ymin] - table.bucket_start[firstRow - ymin]);
+
+    int active = 0;
+    for (int r = firstRow; r < row; ++r) {
+        for (int e = table.bucket_start[r - ymin]; e < table.bucket_start[r - ymin + 1]; ++e) {
+            if (table.edge_ymax[e] <= row)
+                continue;
+            float x = table.edge_x[e];
+            const float dx = table.edge_dx[e];
+            for (int k = r; k < row; ++k) {
+                x += dx;
+            }
+            s.merge_x[active] = x;
+            s.order[active] = e;
+            active++;
+        }
+    }
+
+    // 按 x 排序（借用合并缓冲存放排序后的下标）；x 相等的边谁先谁后不影响输出的段
+    int* rank = s.merge_tag.data();
+    for (int i = 0; i < active; ++i) {
+        rank[i] = i;
+    }
+    const float* mx = s.merge_x.data();
+    std::sort(rank, rank + active, [mx](int a, int b) { return mx[a] < mx[b]; });
+    for (int i = 0; i < active; ++i) {
+        int e = s.order[rank[i]];
+        s.aet_x[i] = mx[rank[i]];
+        s.aet_dx[i] = table.edge_dx[e];
+        s.aet_ymax[i] = table.edge_ymax[e];
+        s.aet_tag[i] = table.edge_tag[e];
+    }
+    return active;
+}
+
+// 自动分带时每条带的最少行数，行数太少时分带的开销超过并行的收益
+static const int kMinBandRows = 16;
+
+void FillPolygonScanlineParallel(PixelBuffer& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    ThreadPool& pool,
+    int bandCount)
+{
+    if (vertexCount < 3)
+        return; // 至少需要 3 个顶点
+
+    int ymin = std::numeric_limits<int>::max();
+    int ymax = std::numeric_limits<int>::min();
+    for (int i = 0; i < vertexCount; ++i) {
+        ymin = std::min(ymin, static_cast<int>(std::floor(y[i])));
+        ymax = std::max(ymax, static_cast<int>(std::ceil(y[i])));
+    }
+
+    // 缓冲区外的行什么都不会画，只扫描可见的行
+    const int rowBegin = std::max(ymin, 0);
+    const int rowEnd = std::min(ymax, target.height - 1);
+    if (rowBegin > rowEnd || target.width <= 0)
+        return;
+
+    // 边表只构建一次，所有带共享（只读）
+    // thread_local 变量不会被 lambda 捕获，工作线程里要通过引用访问调用线程的这一份
+    static thread_local ScanlineScratch tableScratch;
+    ScanlineScratch& table = tableScratch;
+    const int rows = ymax - ymin + 1;
+    const int contourStart[2] = { 0, vertexCount };
+    BuildEdgeTable(x, y, contourStart, nullptr, nullptr, 1, ymin, rows, table);
+
+    int maxEdgeRows = 0;
+    for (int r = 0; r < rows; ++r) {
+        for (int e = table.bucket_start[r]; e < table.bucket_start[r + 1]; ++e) {
+            maxEdgeRows = std::max(maxEdgeRows, table.edge_ymax[e] - (ymin + r));
+        }
+    }
+
+    const int visibleRows = rowEnd - rowBegin + 1;
+    if (bandCount <= 0)
+        bandCount = pool.ThreadCount() * 4; // 每个线程几条带，边分布不均时也能负载均衡
+    bandCount = std::max(1, std::min(bandCount, visibleRows / kMinBandRows));
+
+    // 每条带一份 AET，在调用线程上复用
+    static thread_local std::vector<ScanlineScratch> bandScratch;
+    if (static_cast<int>(bandScratch.size()) < bandCount)
+        bandScratch.resize(bandCount);
+    std::vector<ScanlineScratch>& bands = bandScratch;
+
+    pool.ParallelFor(bandCount, [&](int band) {
+        const int first = rowBegin + static_cast<int>(static_cast<long long>(visibleRows) * band / bandCount);
+        const int last = rowBegin + static_cast<int>(static_cast<long long>(visibleRows) * (band + 1) / bandCount) - 1;
+        ScanlineScratch& s = bands[band];
+        const int active = SeedActiveEdges(table, s, ymin, first, maxEdgeRows);
+
+        // 每条带只写自己的行，不同线程之间没有共享的像素
+        SweepEdgeTable(table, s, ymin, first, last, active, [&](int scanLine, const float* ax, const int*, int count) {
+            for (int i = 0; i + 1 < count; i += 2) {
+                int pixelStart = static_cast<int>(std::ceil(ax[i]));
+                int pixelEnd = static_cast<int>(std::floor(ax[i + 1]));
+                if (pixelEnd >= pixelStart) {
+                    target.PixelBuffer::PlotSpan(pixelStart, pixelEnd, scanLine, color);
+                }
+            }
+        });
+    });
+}
+
+// 记录与左端点为 x0 的新段重叠的那些段，span_group 中每一组的段互相（间接）重叠，组与组之间没有重叠
+// 段按右端点从左到右产生（右端点不减），所以与新段重叠的正好是右端点 >= x0 的那段后缀
+static inline void GroupSceneSpan(ScanlineScratch& s, int x0)
+{
+    const int index = static_cast<int>(s.spans.size());
+    if (index == 0 || s.spans.back().x1 < x0)
+        return; // 不与前面的任何段重叠
+
+    auto overlap = std::lower_bound(s.spans.begin(), s.spans.end(), x0,
+        [](const ScanlineScratch::SceneSpan& span, int x) { return span.x1 < x; });
+    int first = static_cast<int>(overlap - s.spans.begin());
+    while (!s.span_group.empty() && s.span_group.back().last >= first) {
+        first = std::min(first, s.span_group.back().first);
+        s.span_group.pop_back();
+    }
+    s.span_group.push_back(ScanlineScratch::SpanGroup { first, index });
+}
+
+int FillScene::AddFill(ImU32 color, FillRule rule)
+{
+    fills.push_back(Fill { color, rule });
+    return static_cast<int>(fills.size()) - 1;
+}
+
+void FillScene::AddContour(int fill, const float* px, const float* py, int count)
+{
+    x.insert(x.end(), px, px + count);
+    y.insert(y.end(), py, py + count);
+    contour_start.push_back(static_cast<int>(x.size()));
+    contour_fill.push_back(fill);
+}
+
+void FillScene::AddContour(int fill, const std::vector<ImVec2>& points)
+{
+    for (const ImVec2& p : points) {
+        x.push_back(p.x);
+        y.push_back(p.y);
+    }
+    contour_start.push_back(static_cast<int>(x.size()));
+    contour_fill.push_back(fill);
+}
+
+void FillScene::Clear()
+{
+    fills.clear();
+    x.clear();
+    y.clear();
+    contour_start.assign(1, 0);
+    contour_fill.clear();
+}
+
+void FillSceneScanline(RasterTarget& target, const FillScene& scene, ScanlineScratch& s)
+{
+    const int contourCount = scene.ContourCount();
+    const int fillCount = static_cast<int>(scene.fills.size());
+    if (contourCount == 0 || fillCount == 0)
+        return;
+
+    int ymin = std::numeric_limits<int>::max();
+    int ymax = std::numeric_limits<int>::min();
+    for (int c = 0; c < contourCount; ++c) {
+        if (scene.contour_start[c + 1] - scene.contour_start[c] < 3)
+            continue;
+        for (int i = scene.contour_start[c]; i < scene.contour_start[c + 1]; ++i) {
+            ymin = std::min(ymin, static_cast<int>(std::floor(scene.y[i])));
+            ymax = std::max(ymax, static_cast<int>(std::ceil(scene.y[i])));
+        }
+    }
+    if (ymin > ymax)
+        return;
+
+    const int rows = ymax - ymin + 1;
+    BuildEdgeTable(scene.x.data(), scene.y.data(), scene.contour_start.data(),
+        scene.contour_fill.data(), scene.fills.data(), contourCount, ymin, rows, s);
+
+    // 每个填充 ID 的环绕数，扫描线结束时只把碰到的清零
+    s.winding.assign(fillCount, 0);
+    s.span_start.resize(fillCount);
+    const FillScene::Fill* fills = scene.fills.data();
+    int* winding = s.winding.data();
+    int* spanStart = s.span_start.data();
+
+    SweepEdgeTable(s, s, ymin, ymin, ymax, 0, [&](int scanLine, const float* ax, const int* atag, int active) {
+        s.spans.clear();
+        s.span_group.clear();
+        for (int i = 0; i < active; ++i) {
+            // 奇偶规则看环绕数的最低位，非零规则看整个环绕数
+            int tag = atag[i];
+            int fill = tag >> 2;
+            int mask = (tag & 2) ? -1 : 1;
+            int before = winding[fill];
+            int after = before + 1 - ((tag & 1) << 1);
+            winding[fill] = after;
+
+            bool wasInside = (before & mask) != 0;
+            bool isInside = (after & mask) != 0;
+            if (wasInside == isInside)
+                continue;
+            if (isInside) {
+                spanStart[fill] = static_cast<int>(std::ceil(ax[i]));
+            } else {
+                int pixelEnd = static_cast<int>(std::floor(ax[i]));
+                if (pixelEnd >= spanStart[fill]) {
+                    GroupSceneSpan(s, spanStart[fill]);
+                    s.spans.push_back(ScanlineScratch::SceneSpan { fill, spanStart[fill], pixelEnd });
+                }
+            }
+        }
+        for (int i = 0; i < active; ++i) {
+            winding[atag[i] >> 2] = 0;
+        }
+
+        // 互相重叠的段按填充 ID 输出，ID 大的在上层；同一填充内的段互不重叠，再按 x 排序
+        // 其余的段之间没有重叠，输出顺序不影响结果，所以相邻地图区域只在共享像素的地方才需要排序
+        for (const ScanlineScratch::SpanGroup& group : s.span_group) {
+            std::sort(s.spans.begin() + group.first, s.spans.begin() + group.last + 1,
+                [](const ScanlineScratch::SceneSpan& a, const ScanlineScratch::SceneSpan& b) {
+                    return a.fill != b.fill ? a.fill < b.fill : a.x0 < b.x0;
+                });
+        }
+        for (const ScanlineScratch::SceneSpan& span : s.spans) {
+            target.PlotSpan(span.x0, span.x1, scanLine, fills[span.fill].color);
+        }
+    });
+}
+
+void FillSceneScanline(RasterTarget& target, const FillScene& scene)
+{
+    // 边表和活动边表的缓冲按线程复用
+    static thread_local ScanlineScratch scratch;
+    FillSceneScanline(target, scene, scratch);
+}
+
+void FillSceneScanline(ImDrawList* draw_list, ImVec2 canvas_pos, const FillScene& scene)
+{
+    // 每段是一个恰好覆盖像素格的四边形
+    DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+    FillSceneScanline(target, scene);
+}
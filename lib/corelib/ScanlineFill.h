@@ -0,0 +1,116 @@
+#ifndef SCANLINEFILL_H
+#define SCANLINEFILL_H
+
+#include "RasterTarget.h"
+#include <vector>
+
+struct ThreadPool;
+
+// 有序边表扫描线填充的工作缓冲，多次调用之间复用，避免每次都重新分配
+// 边表按起始扫描线分桶，用 CSR 布局存放在一组连续数组里：
+// 第 r 个桶的边是下标 [bucket_start[r], bucket_start[r + 1]) 的边
+// 活动边表（AET）用 SoA 布局，x / dx 各自连续，更新 x 的循环可以向量化
+struct ScanlineScratch {
+    // 边表（CSR）
+    std::vector<int> bucket_start;
+    std::vector<float> edge_x; // 边下端点的 x
+    std::vector<float> edge_dx; // 每条扫描线 x 的增量
+    std::vector<int> edge_ymax; // 边在这条扫描线之前有效（不含）
+    std::vector<int> edge_tag; // 场景填充中边所属的填充 ID、填充规则和方向
+    std::vector<int> edge_bucket; // 构建时暂存每条边所在的桶
+
+    // 活动边表，始终按 x 排序
+    std::vector<float> aet_x;
+    std::vector<float> aet_dx;
+    std::vector<int> aet_ymax;
+    std::vector<int> aet_tag;
+
+    // 合并新边时使用的第二组缓冲
+    std::vector<float> merge_x;
+    std::vector<float> merge_dx;
+    std::vector<int> merge_ymax;
+    std::vector<int> merge_tag;
+    std::vector<int> order; // 同一个桶内的新边按 x 排序后的顺序
+
+    // 场景填充：每个填充 ID 的环绕数，以及一条扫描线上待输出的段
+    std::vector<int> winding;
+    std::vector<int> span_start;
+    struct SceneSpan {
+        int fill;
+        int x0, x1;
+    };
+    std::vector<SceneSpan> spans;
+    struct SpanGroup {
+        int first, last; // spans 中互相重叠的一组段 [first, last]
+    };
+    std::vector<SpanGroup> span_group;
+};
+
+// 有序边表法填充多边形（奇偶规则），像素与原来逐扫描线排序的实现完全相同
+// 新边按 x 有序合并进 AET；相邻扫描线之间边的顺序很少变化，所以用插入排序维持有序
+void FillPolygonScanline(RasterTarget& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    ScanlineScratch& scratch);
+
+// 按行分带并行的有序边表填充，像素与 FillPolygonScanline 完全相同
+// 边表只构建一次；每条带有自己的 AET，在带的第一行按串行扫描相同的累加顺序恢复活动边，
+// 各带只写自己的行，所以目标限定为 PixelBuffer。只扫描缓冲区内的行
+// bandCount 为 0 时按线程数自动选择，每条带至少 16 行
+void FillPolygonScanlineParallel(PixelBuffer& target,
+    const float* x,
+    const float* y,
+    int vertexCount,
+    ImU32 color,
+    ThreadPool& pool,
+    int bandCount = 0);
+
+// 填充规则
+enum FillRule {
+    FILL_EVEN_ODD = 0, // 奇偶规则：穿过奇数条边的区域在内部
+    FILL_NONZERO = 1 // 非零环绕规则：环绕数不为 0 的区域在内部
+};
+
+// 多个填充区域组成的场景，每个填充区域可以由多条轮廓组成（例如带洞的多边形）
+// 所有轮廓的边放进同一张全局边表，整个场景只扫描一遍
+struct FillScene {
+    struct Fill {
+        ImU32 color;
+        FillRule rule;
+    };
+
+    std::vector<Fill> fills;
+    std::vector<float> x, y; // 所有轮廓的顶点依次相接
+    std::vector<int> contour_start; // 第 i 条轮廓的顶点是 [contour_start[i], contour_start[i + 1])
+    std::vector<int> contour_fill; // 每条轮廓所属的填充 ID
+
+    FillScene() { contour_start.push_back(0); }
+
+    // 新建一个填充区域，返回它的填充 ID；ID 大的区域画在上层
+    int AddFill(ImU32 color, FillRule rule = FILL_EVEN_ODD);
+
+    // 给填充区域添加一条闭合轮廓
+    void AddContour(int fill, const float* px, const float* py, int count);
+    void AddContour(int fill, const std::vector<ImVec2>& points);
+
+    int ContourCount() const { return static_cast<int>(contour_fill.size()); }
+
+    void Clear();
+};
+
+// 按扫描线填充整个场景，规则与 DrawPolygonWithOrderedEdgeTable 相同：
+// 只有一条轮廓、使用奇偶规则时，像素与它完全一致
+// 同一条扫描线上重叠的区域按填充 ID 从小到大输出，所以 ID 大的区域在上层
+// 用途是带洞、多轮廓、非零规则和重叠次序在一遍扫描中处理，不是为了比逐个填充快：
+// 每条扫描线的 AET 包含所有区域的边，大量互不重叠的小多边形（例如地图区域）逐个用 FillPolygonScanline 填充反而更快
+void FillSceneScanline(RasterTarget& target, const FillScene& scene, ScanlineScratch& scratch);
+
+// 使用线程内复用的工作缓冲
+void FillSceneScanline(RasterTarget& target, const FillScene& scene);
+
+// 顶点坐标相对 canvas_pos
+void FillSceneScanline(ImDrawList* draw_list, ImVec2 canvas_pos, const FillScene& scene);
+
+#endif // SCANLINEFILL_H
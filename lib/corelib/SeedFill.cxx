@@ -0,0 +1,148 @@
+#include "SeedFill.h"
+#include <algorithm>
+#include <cstring>
+
+BoundaryMask::BoundaryMask(int width, int height)
+    : width(0)
+    , height(0)
+{
+    Resize(width, height);
+}
+
+void BoundaryMask::Resize(int w, int h)
+{
+    width = std::max(0, w);
+    height = std::max(0, h);
+    cells.assign(static_cast<size_t>(width) * height, 0);
+}
+
+void BoundaryMask::Clear()
+{
+    std::fill(cells.begin(), cells.end(), 0);
+}
+
+void BoundaryMask::Plot(int x, int y, ImU32 /*color*/)
+{
+    if (x >= 0 && y >= 0 && x < width && y < height)
+        cells[static_cast<size_t>(y) * width + x] = kBoundary;
+}
+
+void BoundaryMask::PlotSpan(int x0, int x1, int y, ImU32 /*color*/)
+{
+    if (y < 0 || y >= height)
+        return;
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, width - 1);
+    if (x0 > x1)
+        return;
+    std::memset(cells.data() + static_cast<size_t>(y) * width + x0, kBoundary, x1 - x0 + 1);
+}
+
+bool BoundaryMask::GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const
+{
+    xmin = 0;
+    ymin = 0;
+    xmax = width - 1;
+    ymax = height - 1;
+    return true;
+}
+
+// 扫描线种子填充的主体
+// inside(x, y) 判断像素是否可填充；fill(x0, x1, y) 填充一段，之后这些像素的 inside 必须为 false
+template <typename Inside, typename Fill>
+static int SpanSeedFill(int width, int height, int x, int y, SeedFillScratch& scratch, Inside& inside, Fill& fill)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height || !inside(x, y))
+        return 0;
+
+    std::vector<SeedFillScratch::Span>& stack = scratch.stack;
+    stack.clear();
+    auto push = [&](int x0, int x1, int row, int dy) {
+        if (row + dy >= 0 && row + dy < height)
+            stack.push_back({ x0, x1, row, dy });
+    };
+
+    // 种子所在的段
+    int left = x, right = x;
+    while (left > 0 && inside(left - 1, y))
+        --left;
+    while (right + 1 < width && inside(right + 1, y))
+        ++right;
+    fill(left, right, y);
+    int count = right - left + 1;
+    push(left, right, y, 1);
+    push(left, right, y, -1);
+
+    while (!stack.empty()) {
+        const SeedFillScratch::Span parent = stack.back();
+        stack.pop_back();
+        const int row = parent.y + parent.dy;
+
+        // 在第 row 行找出与父段 [x0, x1] 相邻的所有段：第一段可以向左越过父段，最后一段可以向右越过父段
+        int cx = parent.x0;
+        while (cx <= parent.x1) {
+            if (!inside(cx, row)) {
+                ++cx;
+                continue;
+            }
+            left = cx;
+            if (cx == parent.x0) {
+                while (left > 0 && inside(left - 1, row))
+                    --left;
+            }
+            right = cx;
+            while (right + 1 < width && inside(right + 1, row))
+                ++right;
+            fill(left, right, row);
+            count += right - left + 1;
+
+            // 继续朝原方向扩展；越过父段两端的部分，父段所在的行可能还有没填充的像素
+            push(left, right, row, parent.dy);
+            if (left < parent.x0 - 1)
+                push(left, parent.x0 - 2, row, -parent.dy);
+            if (right > parent.x1 + 1)
+                push(parent.x1 + 2, right, row, -parent.dy);
+            cx = right + 2; // right + 1 不可填充
+        }
+    }
+    return count;
+}
+
+int SeedFillBoundaryColor(PixelBuffer& buffer,
+    int x,
+    int y,
+    ImU32 boundary_color,
+    ImU32 fill_color,
+    SeedFillScratch& scratch)
+{
+    if (boundary_color == fill_color)
+        return 0;
+    ImU32* pixels = buffer.pixels.data();
+    const int width = buffer.width;
+    auto inside = [&](int px, int py) {
+        ImU32 c = pixels[static_cast<size_t>(py) * width + px];
+        return c != boundary_color && c != fill_color;
+    };
+    auto fill = [&](int x0, int x1, int py) {
+        ImU32* row = pixels + static_cast<size_t>(py) * width;
+        std::fill(row + x0, row + x1 + 1, fill_color);
+    };
+    return SpanSeedFill(buffer.width, buffer.height, x, y, scratch, inside, fill);
+}
+
+int SeedFillBoundaryMask(RasterTarget& target,
+    BoundaryMask& mask,
+    int x,
+    int y,
+    ImU32 fill_color,
+    SeedFillScratch& scratch)
+{
+    uint8_t* cells = mask.cells.data();
+    const int width = mask.width;
+    auto inside = [&](int px, int py) { return cells[static_cast<size_t>(py) * width + px] == 0; };
+    auto fill = [&](int x0, int x1, int py) {
+        std::memset(cells + static_cast<size_t>(py) * width + x0, BoundaryMask::kFilled, x1 - x0 + 1);
+        target.PlotSpan(x0, x1, py, fill_color);
+    };
+    return SpanSeedFill(mask.width, mask.height, x, y, scratch, inside, fill);
+}
@@ -0,0 +1,65 @@
+#ifndef SEEDFILL_H
+#define SEEDFILL_H
+
+#include "RasterTarget.h"
+#include <cstdint>
+#include <vector>
+
+// 边界掩码：每个像素一个字节，0 为可填充，kBoundary 为边界，kFilled 为已填充
+// 本身也是光栅化目标，可以直接用画线算法把边界画进来
+struct BoundaryMask : RasterTarget {
+    static constexpr uint8_t kBoundary = 1;
+    static constexpr uint8_t kFilled = 2;
+
+    int width;
+    int height;
+    std::vector<uint8_t> cells;
+
+    BoundaryMask(int width = 0, int height = 0);
+
+    // 改变尺寸并清空
+    void Resize(int width, int height);
+    void Clear();
+
+    uint8_t Get(int x, int y) const { return cells[static_cast<size_t>(y) * width + x]; }
+
+    // 画到掩码上的像素都成为边界（颜色被忽略），超出范围的像素直接丢弃
+    void Plot(int x, int y, ImU32 color) override;
+    void PlotSpan(int x0, int x1, int y, ImU32 color) override;
+    bool GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const override;
+};
+
+// 扫描线种子填充的工作缓冲，多次调用之间复用
+struct SeedFillScratch {
+    // 第 y 行的 [x0, x1] 已经填充，待检查第 y + dy 行与它相邻的像素
+    struct Span {
+        int x0, x1;
+        int y, dy;
+    };
+    std::vector<Span> stack;
+};
+
+// 扫描线种子填充（Smith / Heckbert），4 连通
+// 每次从栈中取出一段已填充的像素，在相邻一行中向左右延伸出完整的段后整段填充，
+// 再把新段朝同一方向压栈；新段超出父段的部分还要回头检查父段所在的行。
+// 栈中只存放段，不存放单个像素，所以百万像素的区域也不需要递归或逐像素入栈
+// 返回填充的像素数；种子不在可填充区域内时返回 0
+
+// 以边界颜色为界：颜色既不是 boundary_color 也不是 fill_color 的像素可填充，直接写入 buffer
+int SeedFillBoundaryColor(PixelBuffer& buffer,
+    int x,
+    int y,
+    ImU32 boundary_color,
+    ImU32 fill_color,
+    SeedFillScratch& scratch);
+
+// 以边界掩码为界：mask 中为 0 的像素可填充，填充后记为 kFilled，并把每一段交给 target.PlotSpan
+// target 的像素坐标与掩码相同
+int SeedFillBoundaryMask(RasterTarget& target,
+    BoundaryMask& mask,
+    int x,
+    int y,
+    ImU32 fill_color,
+    SeedFillScratch& scratch);
+
+#endif // SEEDFILL_H
@@ -0,0 +1,96 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(int threads)
+    : job(nullptr)
+    , job_count(0)
+    , generation(0)
+    , busy(0)
+    , stopping(false)
+    , next(0)
+{
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    workers.reserve(threads - 1);
+    for (int i = 1; i < threads; ++i) {
+        workers.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::RunTasks(const std::function<void(int)>& task, int count)
+{
+    for (int i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+        task(i);
+    }
+}
+
+void ThreadPool::WorkerLoop()
+{
+    unsigned seen = 0;
+    for (;;) {
+        const std::function<void(int)>* task;
+        int count;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+            task = job;
+            count = job_count;
+        }
+
+        RunTasks(*task, count);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--busy == 0)
+            done.notify_one();
+    }
+}
+
+void ThreadPool::ParallelFor(int count, const std::function<void(int)>& task)
+{
+    if (count <= 0)
+        return;
+    if (workers.empty() || count == 1) {
+        for (int i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &task;
+        job_count = count;
+        next.store(0);
+        busy = static_cast<int>(workers.size());
+        generation++;
+    }
+    wake.notify_all();
+
+    RunTasks(task, count);
+
+    // 等所有工作线程离开 RunTasks，task 的引用才能失效
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [&]() { return busy == 0; });
+    job = nullptr;
+}
+
+ThreadPool& DefaultThreadPool()
+{
+    static ThreadPool pool;
+    return pool;
+}
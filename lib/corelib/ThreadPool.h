@@ -0,0 +1,47 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 固定数量工作线程的线程池，只提供阻塞式的 ParallelFor
+// 调用线程也参与执行，所以 ThreadPool(1) 不创建任何工作线程，退化为串行执行
+struct ThreadPool {
+    // threads 为参与计算的线程总数（含调用线程），0 表示使用硬件线程数
+    explicit ThreadPool(int threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int ThreadCount() const { return static_cast<int>(workers.size()) + 1; }
+
+    // 对 [0, count) 中的每个下标调用一次 task，任务之间动态分配，全部完成后返回
+    // 同一个线程池同一时间只能有一个 ParallelFor 在执行
+    void ParallelFor(int count, const std::function<void(int)>& task);
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake; // 通知工作线程有新任务或需要退出
+    std::condition_variable done; // 通知调用线程所有工作线程都已离开当前任务
+
+    const std::function<void(int)>* job; // 当前任务，只在 ParallelFor 期间有效
+    int job_count;
+    unsigned generation; // 每次 ParallelFor 加一，工作线程据此判断是否有新任务
+    int busy; // 仍在执行当前任务的工作线程数
+    bool stopping;
+    std::atomic<int> next; // 下一个待执行的下标
+
+    void WorkerLoop();
+    void RunTasks(const std::function<void(int)>& task, int count);
+};
+
+// 进程内共享的线程池，第一次使用时按硬件线程数创建
+ThreadPool& DefaultThreadPool();
+
+#endif // THREADPOOL_H
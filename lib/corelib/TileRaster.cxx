@@ -0,0 +1,340 @@
+#include "TileRaster.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static constexpr int kTileSize = TileRasterScratch::kTileSize;
+static constexpr int kTileShift = TileRasterScratch::kTileShift;
+
+// 最低的 1 所在的位（bits 不为 0）
+static inline int LowestBit(uint64_t bits)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+// 交点 xc 在块内一行产生的翻转：块内列 c 满足 tx + c >= xc 的位为 1
+static inline unsigned RowFlipBits(float xc, int tx)
+{
+    if (xc <= static_cast<float>(tx))
+        return 0xFFu;
+    if (xc > static_cast<float>(tx + kTileSize - 1))
+        return 0u;
+    int first = static_cast<int>(std::ceil(xc)) - tx;
+    return (0xFFu << first) & 0xFFu;
+}
+
+// 块内第 [first, last) 行全部为 1 的掩码
+static inline uint64_t RowsMask(int first, int last)
+{
+    uint64_t rows = (last - first) == kTileSize ? ~0ULL : ((1ULL << (kTileSize * (last - first))) - 1);
+    return rows << (kTileSize * first);
+}
+
+// x 所在的块列：画布左侧为 -1，右侧（包括 NaN）为 tilesX
+static inline int TileColumn(float x, int width, int tilesX)
+{
+    if (x < 0.0f)
+        return -1;
+    if (!(x < static_cast<float>(width)))
+        return tilesX;
+    return static_cast<int>(x) >> kTileShift;
+}
+
+// 收集每个填充的边，再把每条边切成它经过的各行块内的边段
+static void BuildTileEdges(const FillScene& scene, int width, int height, TileRasterScratch& s)
+{
+    const int fillCount = static_cast<int>(scene.fills.size());
+    const int contourCount = scene.ContourCount();
+
+    // 先统计每个填充的非水平边数，前缀和后按填充分组写入
+    s.fill_edge_start.assign(fillCount + 1, 0);
+    for (int c = 0; c < contourCount; ++c) {
+        const int first = scene.contour_start[c];
+        const int last = scene.contour_start[c + 1];
+        if (last - first < 3)
+            continue;
+        for (int i = first; i < last; ++i) {
+            int next = (i + 1) == last ? first : i + 1;
+            if (scene.y[i] != scene.y[next])
+                s.fill_edge_start[scene.contour_fill[c] + 1]++;
+        }
+    }
+    for (int f = 0; f < fillCount; ++f) {
+        s.fill_edge_start[f + 1] += s.fill_edge_start[f];
+    }
+    s.edges.resize(s.fill_edge_start[fillCount]);
+
+    s.cursor.assign(s.fill_edge_start.begin(), s.fill_edge_start.end() - 1);
+    for (int c = 0; c < contourCount; ++c) {
+        const int first = scene.contour_start[c];
+        const int last = scene.contour_start[c + 1];
+        if (last - first < 3)
+            continue;
+        const int fill = scene.contour_fill[c];
+        for (int i = first; i < last; ++i) {
+            int next = (i + 1) == last ? first : i + 1;
+            float x0f = scene.x[i];
+            float y0f = scene.y[i];
+            float x1f = scene.x[next];
+            float y1f = scene.y[next];
+            if (y0f == y1f)
+                continue; // 忽略水平边
+
+            int winding = 1;
+            if (y0f > y1f) {
+                std::swap(x0f, x1f);
+                std::swap(y0f, y1f);
+                winding = -1;
+            }
+
+            // 边经过满足 y0 <= row < y1 的整数行，首尾相接的边在公共顶点上恰好只算一次
+            TileRasterScratch::Edge& edge = s.edges[s.cursor[fill]++];
+            edge.x0 = x0f;
+            edge.y0 = y0f;
+            edge.dx = (x1f - x0f) / (y1f - y0f);
+            edge.row0 = static_cast<int>(std::ceil(y0f));
+            edge.row1 = std::max(edge.row0, static_cast<int>(std::ceil(y1f)));
+            edge.winding = winding;
+        }
+    }
+
+    // 边段：每条边在它经过的每一行块内，交点范围由这几行首尾两行的交点给出（TileEdgeX 随行单调）
+    // 整段在画布右侧的边段不影响任何像素，直接丢弃；按填充顺序处理边，所以每行块内的填充 ID 从小到大
+    const int tilesX = (width + kTileSize - 1) >> kTileShift;
+    const int tilesY = (height + kTileSize - 1) >> kTileShift;
+    auto for_each_segment = [&](auto emit) {
+        for (int f = 0; f < fillCount; ++f) {
+            for (int e = s.fill_edge_start[f]; e < s.fill_edge_start[f + 1]; ++e) {
+                const TileRasterScratch::Edge& edge = s.edges[e];
+                const int rowFirst = std::max(edge.row0, 0);
+                const int rowLast = std::min(edge.row1, height) - 1;
+                if (rowFirst > rowLast)
+                    continue;
+                for (int tileY = rowFirst >> kTileShift; tileY <= (rowLast >> kTileShift); ++tileY) {
+                    const int r0 = std::max(rowFirst, tileY << kTileShift);
+                    const int r1 = std::min(rowLast, (tileY << kTileShift) + kTileSize - 1);
+                    const float xa = TileEdgeX(edge, r0);
+                    const float xb = TileEdgeX(edge, r1);
+                    const int tx0 = std::max(TileColumn(std::min(xa, xb), width, tilesX), 0);
+                    const int tx1 = TileColumn(std::max(xa, xb), width, tilesX);
+                    if (tx0 < tilesX)
+                        emit(tileY, TileRasterScratch::Segment { f, e, tx0, tx1 });
+                }
+            }
+        }
+    };
+
+    s.row_segment_start.assign(tilesY + 1, 0);
+    for_each_segment([&](int tileY, const TileRasterScratch::Segment&) { s.row_segment_start[tileY + 1]++; });
+    for (int t = 0; t < tilesY; ++t) {
+        s.row_segment_start[t + 1] += s.row_segment_start[t];
+    }
+    s.segments.resize(s.row_segment_start[tilesY]);
+    s.cursor.assign(s.row_segment_start.begin(), s.row_segment_start.end() - 1);
+    for_each_segment([&](int tileY, const TileRasterScratch::Segment& segment) { s.segments[s.cursor[tileY]++] = segment; });
+}
+
+namespace {
+
+// 一行块的工作缓冲，每个工作线程一份
+struct TileRowScratch {
+    std::vector<ImU32> colors; // 每个块 64 个像素的颜色
+    std::vector<uint64_t> written; // 每个块已写入的像素
+    std::vector<int> by_start; // 一个填充的边段，按 tx0 排序
+    std::vector<int> by_end; // 同上，按 tx1 排序
+    std::vector<int> active; // 交点落在当前块内的边段
+};
+
+} // namespace
+
+// 一个填充在一行块内的覆盖：从左到右扫描，边段进入交点范围时逐行求翻转，离开后并入底色
+// 底色是左侧所有边段对每一行的整行翻转（奇偶规则为每行的奇偶性，非零规则为每行的环绕数）
+// 没有边段的块直接用底色；底色为 0 又没有边段时跳到下一个边段的起点
+static void ResolveFillRow(const TileRasterScratch& s,
+    const TileRasterScratch::Segment* segments,
+    int count,
+    bool nonzero,
+    ImU32 color,
+    int tileY,
+    int tilesX,
+    TileRowScratch& row)
+{
+    const int ty = tileY << kTileShift;
+    row.by_start.resize(count);
+    row.by_end.resize(count);
+    for (int i = 0; i < count; ++i) {
+        row.by_start[i] = i;
+        row.by_end[i] = i;
+    }
+    std::sort(row.by_start.begin(), row.by_start.end(), [&](int a, int b) { return segments[a].tx0 < segments[b].tx0; });
+    std::sort(row.by_end.begin(), row.by_end.end(), [&](int a, int b) { return segments[a].tx1 < segments[b].tx1; });
+    row.active.clear();
+
+    uint64_t parity = 0; // 奇偶规则的底色
+    int backdrop[kTileSize] = {}; // 非零规则的底色
+    int nextStart = 0, nextEnd = 0;
+    int tileX = segments[row.by_start[0]].tx0;
+    while (tileX < tilesX) {
+        // 完全在这个块左侧的边段并入底色
+        for (; nextEnd < count && segments[row.by_end[nextEnd]].tx1 < tileX; ++nextEnd) {
+            const TileRasterScratch::Edge& edge = s.edges[segments[row.by_end[nextEnd]].edge];
+            const int r0 = std::max(edge.row0, ty);
+            const int r1 = std::min(edge.row1, ty + kTileSize);
+            if (nonzero) {
+                for (int r = r0; r < r1; ++r)
+                    backdrop[r - ty] += edge.winding;
+            } else {
+                parity ^= RowsMask(r0 - ty, r1 - ty);
+            }
+        }
+        for (; nextStart < count && segments[row.by_start[nextStart]].tx0 <= tileX; ++nextStart)
+            row.active.push_back(row.by_start[nextStart]);
+        for (size_t i = 0; i < row.active.size();) {
+            if (segments[row.active[i]].tx1 < tileX) {
+                row.active[i] = row.active.back();
+                row.active.pop_back();
+            } else {
+                ++i;
+            }
+        }
+
+        bool emptyBackdrop = parity == 0;
+        if (nonzero) {
+            for (int r = 0; r < kTileSize; ++r)
+                emptyBackdrop = emptyBackdrop && backdrop[r] == 0;
+        }
+        if (row.active.empty() && emptyBackdrop) {
+            if (nextStart == count)
+                break;
+            tileX = segments[row.by_start[nextStart]].tx0;
+            continue;
+        }
+
+        const int tx = tileX << kTileShift;
+        uint64_t mask = 0;
+        if (nonzero) {
+            int winding[kTileSize * kTileSize];
+            for (int r = 0; r < kTileSize; ++r)
+                std::fill(winding + kTileSize * r, winding + kTileSize * (r + 1), backdrop[r]);
+            for (int index : row.active) {
+                const TileRasterScratch::Edge& edge = s.edges[segments[index].edge];
+                const int r0 = std::max(edge.row0, ty);
+                const int r1 = std::min(edge.row1, ty + kTileSize);
+                for (int r = r0; r < r1; ++r) {
+                    unsigned bits = RowFlipBits(TileEdgeX(edge, r), tx);
+                    int* w = winding + kTileSize * (r - ty);
+                    for (int c = 0; c < kTileSize; ++c) {
+                        if (bits & (1u << c))
+                            w[c] += edge.winding;
+                    }
+                }
+            }
+            for (int i = 0; i < kTileSize * kTileSize; ++i) {
+                if (winding[i] != 0)
+                    mask |= 1ULL << i;
+            }
+        } else {
+            // 奇偶规则：每条边在它经过的每一行把交点右侧的像素翻转一次
+            mask = parity;
+            for (int index : row.active) {
+                const TileRasterScratch::Edge& edge = s.edges[segments[index].edge];
+                const int r0 = std::max(edge.row0, ty);
+                const int r1 = std::min(edge.row1, ty + kTileSize);
+                for (int r = r0; r < r1; ++r)
+                    mask ^= static_cast<uint64_t>(RowFlipBits(TileEdgeX(edge, r), tx)) << (kTileSize * (r - ty));
+            }
+        }
+
+        if (mask != 0) {
+            ImU32* colors = row.colors.data() + static_cast<size_t>(tileX) * kTileSize * kTileSize;
+            if (mask == ~0ULL) {
+                std::fill(colors, colors + kTileSize * kTileSize, color);
+            } else {
+                for (uint64_t bits = mask; bits != 0; bits &= bits - 1) {
+                    colors[LowestBit(bits)] = color;
+                }
+            }
+            row.written[tileX] |= mask;
+        }
+        ++tileX;
+    }
+}
+
+// 求一行块内所有填充的覆盖并写出像素，ID 大的填充覆盖 ID 小的
+static void ResolveTileRow(PixelBuffer& target, const FillScene& scene, const TileRasterScratch& s, int tileY, int tilesX)
+{
+    const int first = s.row_segment_start[tileY];
+    const int last = s.row_segment_start[tileY + 1];
+    if (first == last)
+        return;
+
+    static thread_local TileRowScratch row;
+    row.colors.resize(static_cast<size_t>(tilesX) * kTileSize * kTileSize);
+    row.written.assign(tilesX, 0);
+    for (int k = first; k < last;) {
+        const int fill = s.segments[k].fill;
+        int end = k + 1;
+        while (end < last && s.segments[end].fill == fill)
+            ++end;
+        ResolveFillRow(s, s.segments.data() + k, end - k, scene.fills[fill].rule == FILL_NONZERO, scene.fills[fill].color, tileY, tilesX, row);
+        k = end;
+    }
+
+    // 画布右侧和下侧不满一块的部分不写
+    const int ty = tileY << kTileShift;
+    const int rows = std::min(kTileSize, target.height - ty);
+    for (int tileX = 0; tileX < tilesX; ++tileX) {
+        const uint64_t written = row.written[tileX];
+        if (written == 0)
+            continue;
+        const int tx = tileX << kTileShift;
+        const int columns = std::min(kTileSize, target.width - tx);
+        const ImU32* colors = row.colors.data() + static_cast<size_t>(tileX) * kTileSize * kTileSize;
+        for (int r = 0; r < rows; ++r) {
+            unsigned rowBits = static_cast<unsigned>(written >> (kTileSize * r)) & 0xFFu;
+            if (rowBits == 0)
+                continue;
+            ImU32* dst = target.pixels.data() + static_cast<size_t>(ty + r) * target.width + tx;
+            const ImU32* src = colors + kTileSize * r;
+            if (rowBits == 0xFFu && columns == kTileSize) {
+                std::memcpy(dst, src, sizeof(ImU32) * kTileSize);
+                continue;
+            }
+            for (int c = 0; c < columns; ++c) {
+                if (rowBits & (1u << c))
+                    dst[c] = src[c];
+            }
+        }
+    }
+}
+
+void FillSceneTiled(PixelBuffer& target, const FillScene& scene, ThreadPool& pool, TileRasterScratch& s)
+{
+    const int fillCount = static_cast<int>(scene.fills.size());
+    if (fillCount == 0 || scene.ContourCount() == 0 || target.width <= 0 || target.height <= 0)
+        return;
+
+    const int tilesX = (target.width + kTileSize - 1) >> kTileShift;
+    const int tilesY = (target.height + kTileSize - 1) >> kTileShift;
+    BuildTileEdges(scene, target.width, target.height, s);
+
+    // 每个任务处理一行块，块之间不共享像素
+    pool.ParallelFor(tilesY, [&](int tileY) { ResolveTileRow(target, scene, s, tileY, tilesX); });
+}
+
+void FillSceneTiled(PixelBuffer& target, const FillScene& scene, ThreadPool& pool)
+{
+    // 工作缓冲按调用线程复用，分块阶段只读
+    static thread_local TileRasterScratch scratch;
+    FillSceneTiled(target, scene, pool, scratch);
+}
@@ -0,0 +1,59 @@
+#ifndef TILERASTER_H
+#define TILERASTER_H
+
+#include "ScanlineFill.h"
+#include <cstdint>
+#include <vector>
+
+struct ThreadPool;
+
+// 分块（tile）填充的工作缓冲，多次调用之间复用
+// 画布按 8x8 分块，每个块的覆盖用一个 64 位掩码表示（第 r 行第 c 列为第 r * 8 + c 位）
+struct TileRasterScratch {
+    static constexpr int kTileShift = 3;
+    static constexpr int kTileSize = 1 << kTileShift;
+
+    // 一条边：(x0, y0) 为下端点，在 [row0, row1) 行内有效，交点由 TileEdgeX 计算
+    struct Edge {
+        float x0, y0, dx;
+        int row0, row1;
+        int winding; // 原方向向下（y 增大）为 +1，否则为 -1
+    };
+
+    // 边在一行块（8 行像素）内的一段：交点落在块列 [tx0, tx1] 内（tx0 不小于 0），
+    // 这些块逐行求翻转；tx1 右侧的块被这段经过的行整行翻转，只需累加到底色中
+    struct Segment {
+        int fill;
+        int edge;
+        int tx0, tx1;
+    };
+
+    std::vector<Edge> edges; // 按填充 ID 分组
+    std::vector<int> fill_edge_start; // 第 f 个填充的边是 [fill_edge_start[f], fill_edge_start[f + 1])
+
+    // 每行块内的边段（CSR，按填充 ID 从小到大）
+    std::vector<int> row_segment_start;
+    std::vector<Segment> segments;
+
+    std::vector<int> cursor; // 按组写入时每组的写入位置
+};
+
+// 边与第 row 行（y = row）的交点
+inline float TileEdgeX(const TileRasterScratch::Edge& edge, int row)
+{
+    return edge.x0 + edge.dx * (static_cast<float>(row) - edge.y0);
+}
+
+// 分块填充整个场景：每条边按它经过的行块切成边段，每段只交给交点所在的几个块；
+// 段右侧的块只受整行翻转的影响，从左到右扫描一行块时累加成底色，内部的块不用看任何边
+// 各行块在线程池上并行求覆盖掩码并写出像素，耗时与边段数加上被覆盖的块数成正比
+// 块内按填充 ID 从小到大写入，ID 大的在上层；块之间不共享像素，所以目标限定为 PixelBuffer
+// 采样点为整数坐标 (x, y)：边经过满足 y0 <= y < y1 的行，像素按第 y 行上交点 xc <= x 的边计数，
+// 再按填充规则判断是否在内部。上下、左右都是半开的，所以共边的相邻区域没有重叠也没有缝隙
+// （扫描线填充沿用原来的边表规则，局部极值顶点和整数交点上的像素与这里不同）
+void FillSceneTiled(PixelBuffer& target, const FillScene& scene, ThreadPool& pool, TileRasterScratch& scratch);
+
+// 使用线程内复用的工作缓冲
+void FillSceneTiled(PixelBuffer& target, const FillScene& scene, ThreadPool& pool);
+
+#endif // TILERASTER_H
@@ -0,0 +1,454 @@
+#include "Triangulate.h"
+#include <algorithm>
+#include <imgui_internal.h> // ImDrawListSharedData::TexUvWhitePixel
+#include <cstring>
+#include <iterator>
+
+// 顶点类型
+enum MonotoneVertexType {
+    VERTEX_REGULAR = 0,
+    VERTEX_START,
+    VERTEX_END,
+    VERTEX_SPLIT,
+    VERTEX_MERGE,
+};
+
+// 扫描顺序：y 小的在下，y 相同时 x 小的在下
+static inline bool Below(const ImVec2& a, const ImVec2& b)
+{
+    return a.y < b.y || (a.y == b.y && a.x < b.x);
+}
+
+// p1 -> p2 -> p3 向左转（叉积为正）
+static inline bool IsConvex(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3)
+{
+    return (p3.y - p1.y) * (p2.x - p1.x) - (p3.x - p1.x) * (p2.y - p1.y) > 0.0f;
+}
+
+// 状态中的边互不相交，用点在边的哪一侧比较左右，不需要求交点，水平边也能处理
+bool TriangulationScratch::ScanEdge::operator<(const ScanEdge& other) const
+{
+    if (other.p1.y == other.p2.y) {
+        if (p1.y == p2.y)
+            return p1.y < other.p1.y;
+        return IsConvex(p1, p2, other.p1);
+    }
+    if (p1.y == p2.y || p1.y < other.p1.y)
+        return !IsConvex(other.p1, other.p2, p1);
+    return IsConvex(p1, p2, other.p1);
+}
+
+// 在 a 和 b 之间加一条对角线：两个顶点各复制一份，把一个环拆成两个
+// 复制出的顶点继承原顶点的类型、helper 和以它为起点的边
+static void AddDiagonal(TriangulationScratch& s, int a, int b)
+{
+    std::vector<TriangulationScratch::Vertex>& v = s.vertices;
+    const int na = static_cast<int>(v.size());
+    const int nb = na + 1;
+    v.push_back(v[a]);
+    v.push_back(v[b]);
+    v[nb].next = v[b].next;
+    v[na].next = v[a].next;
+    v[v[b].next].prev = nb;
+    v[v[a].next].prev = na;
+    v[a].next = nb;
+    v[nb].prev = a;
+    v[b].next = na;
+    v[na].prev = b;
+
+    const int copies[2][2] = { { na, a }, { nb, b } };
+    for (const auto& copy : copies) {
+        s.type.push_back(s.type[copy[1]]);
+        s.helper.push_back(s.helper[copy[1]]);
+        s.edge_iter.push_back(s.edge_iter[copy[1]]);
+        if (s.edge_iter[copy[0]] != s.status.end())
+            s.edge_iter[copy[0]]->index = copy[0];
+    }
+}
+
+// 状态中紧靠 p 左侧的边；不存在时返回 end()
+static std::set<TriangulationScratch::ScanEdge>::iterator LeftEdge(TriangulationScratch& s, const ImVec2& p)
+{
+    TriangulationScratch::ScanEdge query { p, p, -1 };
+    auto it = s.status.lower_bound(query);
+    if (it == s.status.begin())
+        return s.status.end();
+    return --it;
+}
+
+// 插入以 v 为起点的边
+static void InsertEdge(TriangulationScratch& s, int v, int helper)
+{
+    const TriangulationScratch::Vertex& vertex = s.vertices[v];
+    s.edge_iter[v] = s.status.insert({ vertex.p, s.vertices[vertex.next].p, v }).first;
+    s.helper[v] = helper;
+}
+
+// 按扫描线从上到下加对角线，把多边形分成若干 y 单调多边形
+static bool MonotonePartition(TriangulationScratch& s)
+{
+    const int n = static_cast<int>(s.vertices.size());
+    s.order.resize(n);
+    for (int i = 0; i < n; ++i)
+        s.order[i] = i;
+    std::sort(s.order.begin(), s.order.end(), [&](int a, int b) { return Below(s.vertices[b].p, s.vertices[a].p); });
+
+    s.type.resize(n);
+    for (int i = 0; i < n; ++i) {
+        const ImVec2& p = s.vertices[i].p;
+        const ImVec2& prev = s.vertices[s.vertices[i].prev].p;
+        const ImVec2& next = s.vertices[s.vertices[i].next].p;
+        if (Below(prev, p) && Below(next, p))
+            s.type[i] = IsConvex(next, prev, p) ? VERTEX_START : VERTEX_SPLIT;
+        else if (Below(p, prev) && Below(p, next))
+            s.type[i] = IsConvex(next, prev, p) ? VERTEX_END : VERTEX_MERGE;
+        else
+            s.type[i] = VERTEX_REGULAR;
+    }
+
+    s.status.clear();
+    s.helper.assign(n, -1);
+    s.edge_iter.assign(n, s.status.end());
+
+    for (int k = 0; k < n; ++k) {
+        const int v = s.order[k];
+        const int prev = s.vertices[v].prev;
+        int v2 = v; // 加了对角线之后，继续向下的边从复制出的顶点出发
+        switch (s.type[v]) {
+        case VERTEX_START:
+            InsertEdge(s, v, v);
+            break;
+
+        case VERTEX_END:
+            if (s.edge_iter[prev] == s.status.end())
+                return false;
+            if (s.type[s.helper[prev]] == VERTEX_MERGE)
+                AddDiagonal(s, v, s.helper[prev]);
+            s.status.erase(s.edge_iter[prev]);
+            s.edge_iter[prev] = s.status.end();
+            break;
+
+        case VERTEX_SPLIT: {
+            auto left = LeftEdge(s, s.vertices[v].p);
+            if (left == s.status.end())
+                return false;
+            AddDiagonal(s, v, s.helper[left->index]);
+            v2 = static_cast<int>(s.vertices.size()) - 2;
+            s.helper[left->index] = v;
+            InsertEdge(s, v2, v2);
+            break;
+        }
+
+        case VERTEX_MERGE: {
+            if (s.edge_iter[prev] == s.status.end())
+                return false;
+            if (s.type[s.helper[prev]] == VERTEX_MERGE) {
+                AddDiagonal(s, v, s.helper[prev]);
+                v2 = static_cast<int>(s.vertices.size()) - 2;
+            }
+            s.status.erase(s.edge_iter[prev]);
+            s.edge_iter[prev] = s.status.end();
+            auto left = LeftEdge(s, s.vertices[v].p);
+            if (left == s.status.end())
+                return false;
+            if (s.type[s.helper[left->index]] == VERTEX_MERGE)
+                AddDiagonal(s, v2, s.helper[left->index]);
+            s.helper[left->index] = v2;
+            break;
+        }
+
+        default:
+            if (Below(s.vertices[v].p, s.vertices[prev].p)) {
+                // 左链上的顶点（内部在右侧）：上面的边结束，下面的边开始
+                if (s.edge_iter[prev] == s.status.end())
+                    return false;
+                if (s.type[s.helper[prev]] == VERTEX_MERGE) {
+                    AddDiagonal(s, v, s.helper[prev]);
+                    v2 = static_cast<int>(s.vertices.size()) - 2;
+                }
+                s.status.erase(s.edge_iter[prev]);
+                s.edge_iter[prev] = s.status.end();
+                InsertEdge(s, v2, v);
+            } else {
+                auto left = LeftEdge(s, s.vertices[v].p);
+                if (left == s.status.end())
+                    return false;
+                if (s.type[s.helper[left->index]] == VERTEX_MERGE)
+                    AddDiagonal(s, v, s.helper[left->index]);
+                s.helper[left->index] = v;
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+// 三角化一个 y 单调多边形（s.chain 中按逆时针排列的顶点），三角形按原顶点下标追加到 indices
+static bool TriangulateMonotone(TriangulationScratch& s, std::vector<int>& indices)
+{
+    const std::vector<int>& chain = s.chain;
+    const int n = static_cast<int>(chain.size());
+    auto point = [&](int i) -> const ImVec2& { return s.vertices[chain[i]].p; };
+    auto emit = [&](int a, int b, int c) {
+        indices.push_back(s.vertices[chain[a]].index);
+        indices.push_back(s.vertices[chain[b]].index);
+        indices.push_back(s.vertices[chain[c]].index);
+    };
+    if (n < 3)
+        return false;
+    if (n == 3) {
+        emit(0, 1, 2);
+        return true;
+    }
+
+    int top = 0, bottom = 0;
+    for (int i = 1; i < n; ++i) {
+        if (Below(point(i), point(bottom)))
+            bottom = i;
+        if (Below(point(top), point(i)))
+            top = i;
+    }
+    // 检查确实是单调的：从最高点沿链向下一直到最低点，再一直向上回到最高点
+    for (int i = top; i != bottom; i = (i + 1) % n) {
+        if (!Below(point((i + 1) % n), point(i)))
+            return false;
+    }
+    for (int i = bottom; i != top; i = (i + 1) % n) {
+        if (!Below(point(i), point((i + 1) % n)))
+            return false;
+    }
+
+    // 合并左右两条链，side 为 1 表示左链，-1 表示右链
+    std::vector<int>& order = s.chain_order;
+    std::vector<int>& side = s.chain_side;
+    order.resize(n);
+    side.assign(n, 0);
+    order[0] = top;
+    int left = (top + 1) % n;
+    int right = (top + n - 1) % n;
+    int k = 1;
+    for (; k < n - 1; ++k) {
+        if (left == bottom || (right != bottom && Below(point(left), point(right)))) {
+            order[k] = right;
+            right = (right + n - 1) % n;
+            side[order[k]] = -1;
+        } else {
+            order[k] = left;
+            left = (left + 1) % n;
+            side[order[k]] = 1;
+        }
+    }
+    order[k] = bottom;
+
+    // 从上到下：换链时把栈中的顶点全部连到当前顶点；同链时只要是凸角就不断切掉三角形
+    std::vector<int>& stack = s.stack;
+    stack.assign(n, 0);
+    stack[0] = order[0];
+    stack[1] = order[1];
+    int top_of_stack = 2;
+    for (k = 2; k < n - 1; ++k) {
+        const int v = order[k];
+        if (side[v] != side[stack[top_of_stack - 1]]) {
+            for (int j = 0; j < top_of_stack - 1; ++j) {
+                if (side[v] == 1)
+                    emit(stack[j + 1], stack[j], v);
+                else
+                    emit(stack[j], stack[j + 1], v);
+            }
+            stack[0] = order[k - 1];
+            stack[1] = v;
+            top_of_stack = 2;
+        } else {
+            top_of_stack--;
+            while (top_of_stack > 0) {
+                const int a = stack[top_of_stack - 1];
+                const int b = stack[top_of_stack];
+                if (side[v] == 1 ? IsConvex(point(v), point(a), point(b)) : IsConvex(point(v), point(b), point(a))) {
+                    if (side[v] == 1)
+                        emit(v, a, b);
+                    else
+                        emit(v, b, a);
+                    top_of_stack--;
+                } else {
+                    break;
+                }
+            }
+            top_of_stack++;
+            stack[top_of_stack++] = v;
+        }
+    }
+    const int last = order[k];
+    for (int j = 0; j < top_of_stack - 1; ++j) {
+        if (side[stack[j + 1]] == 1)
+            emit(stack[j], stack[j + 1], last);
+        else
+            emit(stack[j + 1], stack[j], last);
+    }
+    return true;
+}
+
+bool TriangulatePolygon(const ImVec2* points, int count, std::vector<int>& indices, TriangulationScratch& scratch)
+{
+    indices.clear();
+
+    // 去掉相邻的重复顶点，并统一成逆时针（有向面积为正）
+    std::vector<TriangulationScratch::Vertex>& vertices = scratch.vertices;
+    vertices.clear();
+    for (int i = 0; i < count; ++i) {
+        if (!vertices.empty() && vertices.back().p.x == points[i].x && vertices.back().p.y == points[i].y)
+            continue;
+        vertices.push_back({ points[i], i, 0, 0 });
+    }
+    while (vertices.size() > 1 && vertices.back().p.x == vertices.front().p.x && vertices.back().p.y == vertices.front().p.y)
+        vertices.pop_back();
+    const int n = static_cast<int>(vertices.size());
+    if (n < 3)
+        return false;
+
+    float area = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        const ImVec2& a = vertices[i].p;
+        const ImVec2& b = vertices[(i + 1) % n].p;
+        area += a.x * b.y - a.y * b.x;
+    }
+    if (area == 0.0f)
+        return false;
+    if (area < 0.0f)
+        std::reverse(vertices.begin(), vertices.end());
+    for (int i = 0; i < n; ++i) {
+        vertices[i].prev = (i + n - 1) % n;
+        vertices[i].next = (i + 1) % n;
+    }
+
+    // 每条对角线复制两个顶点，对角线最多 n - 3 条
+    vertices.reserve(static_cast<size_t>(n) * 3);
+    if (!MonotonePartition(scratch))
+        return false;
+
+    // 沿 next 指针取出每个单调多边形分别三角化
+    const int total = static_cast<int>(vertices.size());
+    scratch.used.assign(total, 0);
+    indices.reserve(static_cast<size_t>(n - 2) * 3);
+    for (int i = 0; i < total; ++i) {
+        if (scratch.used[i])
+            continue;
+        scratch.chain.clear();
+        int v = i;
+        do {
+            if (scratch.used[v])
+                return false; // 链表被破坏（多边形不是简单多边形）
+            scratch.used[v] = 1;
+            scratch.chain.push_back(v);
+            v = vertices[v].next;
+        } while (v != i);
+        if (!TriangulateMonotone(scratch, indices))
+            return false;
+    }
+    return static_cast<int>(indices.size()) == (n - 2) * 3;
+}
+
+// 顶点数据的 64 位 FNV-1a 哈希
+static uint64_t HashPoints(const ImVec2* points, int count)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(points);
+    const size_t size = static_cast<size_t>(count) * sizeof(ImVec2);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash ^ static_cast<uint64_t>(count);
+}
+
+TriangulationCache::TriangulationCache(size_t capacity)
+    : capacity(capacity)
+    , hits(0)
+    , misses(0)
+    , bytes(0)
+{
+}
+
+void TriangulationCache::Clear()
+{
+    entries.clear();
+    lookup.clear();
+    bytes = 0;
+}
+
+const std::vector<int>& TriangulationCache::Triangulate(const ImVec2* points, int count)
+{
+    const uint64_t key = HashPoints(points, count);
+    auto range = lookup.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const Entry& entry = *it->second;
+        if (static_cast<int>(entry.points.size()) == count
+            && std::memcmp(entry.points.data(), points, static_cast<size_t>(count) * sizeof(ImVec2)) == 0) {
+            hits++;
+            entries.splice(entries.begin(), entries, it->second);
+            return entries.front().indices;
+        }
+    }
+
+    misses++;
+    // 淘汰最久未使用的条目
+    while (!entries.empty() && entries.size() >= std::max<size_t>(capacity, 1)) {
+        const Entry& last = entries.back();
+        bytes -= last.points.size() * sizeof(ImVec2) + last.indices.size() * sizeof(int);
+        auto victims = lookup.equal_range(last.key);
+        for (auto it = victims.first; it != victims.second; ++it) {
+            if (it->second == std::prev(entries.end())) {
+                lookup.erase(it);
+                break;
+            }
+        }
+        entries.pop_back();
+    }
+
+    entries.push_front(Entry { key, std::vector<ImVec2>(points, points + count), {} });
+    Entry& entry = entries.front();
+    if (!TriangulatePolygon(points, count, entry.indices, scratch))
+        entry.indices.clear();
+    entry.indices.shrink_to_fit();
+    lookup.emplace(key, entries.begin());
+    bytes += entry.points.size() * sizeof(ImVec2) + entry.indices.size() * sizeof(int);
+    return entry.indices;
+}
+
+void DrawPolygonFilledTriangulated(ImDrawList* draw_list,
+    ImVec2 canvas_pos,
+    const std::vector<ImVec2>& polygon,
+    ImU32 color,
+    TriangulationCache& cache)
+{
+    const int count = static_cast<int>(polygon.size());
+    if (count < 3 || (color & IM_COL32_A_MASK) == 0)
+        return;
+
+    const std::vector<int>& indices = cache.Triangulate(polygon.data(), count);
+    // 16 位索引下一次 PrimReserve 最多 65536 个顶点
+    if (indices.empty() || (sizeof(ImDrawIdx) == 2 && count > 0xFFFF)) {
+        std::vector<ImVec2> screen(polygon);
+        for (ImVec2& p : screen) {
+            p.x += canvas_pos.x;
+            p.y += canvas_pos.y;
+        }
+        draw_list->AddConvexPolyFilled(screen.data(), count, color);
+        return;
+    }
+
+    // 与 AddConvexPolyFilled 的非抗锯齿路径相同：使用白色像素的纹理坐标，按原顶点写入顶点缓冲
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    const int index_count = static_cast<int>(indices.size());
+    draw_list->PrimReserve(index_count, count);
+    const unsigned int base = draw_list->_VtxCurrentIdx;
+    for (int i = 0; i < count; ++i) {
+        draw_list->_VtxWritePtr[i].pos = ImVec2(canvas_pos.x + polygon[i].x, canvas_pos.y + polygon[i].y);
+        draw_list->_VtxWritePtr[i].uv = uv;
+        draw_list->_VtxWritePtr[i].col = color;
+    }
+    for (int i = 0; i < index_count; ++i)
+        draw_list->_IdxWritePtr[i] = static_cast<ImDrawIdx>(base + indices[i]);
+    draw_list->_VtxWritePtr += count;
+    draw_list->_IdxWritePtr += index_count;
+    draw_list->_VtxCurrentIdx += count;
+}
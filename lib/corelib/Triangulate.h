@@ -0,0 +1,90 @@
+#ifndef TRIANGULATE_H
+#define TRIANGULATE_H
+
+#include <cstdint>
+#include <imgui.h>
+#include <list>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+// 单调划分三角化的工作缓冲，多次调用之间复用
+struct TriangulationScratch {
+    // 双向链表中的顶点；加对角线时两端各复制一份，所以最多有 3n 个
+    struct Vertex {
+        ImVec2 p;
+        int index; // 原多边形中的下标
+        int prev, next;
+    };
+    std::vector<Vertex> vertices;
+    std::vector<int> order; // 按从上到下排序的顶点
+    std::vector<int> type; // 起始、终止、分裂、合并、普通
+    std::vector<int> helper; // 以该顶点为起点的边的 helper
+
+    // 扫描线状态：与扫描线相交、内部在其右侧的边，从左到右排序
+    struct ScanEdge {
+        ImVec2 p1, p2;
+        mutable int index; // 起点，加对角线复制顶点后会改变
+        bool operator<(const ScanEdge& other) const;
+    };
+    std::set<ScanEdge> status;
+    std::vector<std::set<ScanEdge>::iterator> edge_iter; // 以该顶点为起点的边在 status 中的位置，不在时为 end()
+    std::vector<char> used;
+
+    // 一个单调多边形
+    std::vector<int> chain;
+    std::vector<int> chain_order;
+    std::vector<int> chain_side;
+    std::vector<int> stack;
+};
+
+// 单调划分三角化简单多边形（可以是凹的，顶点顺序任意），O(n log n)
+// 1. 从上到下扫描，在分裂顶点和合并顶点处加对角线，把多边形分成若干 y 单调多边形
+// 2. 每个单调多边形沿左右两条链合并后用一个栈在线性时间内切出三角形
+// 三角形按原顶点下标写入 indices（每 3 个一个三角形），返回 false 表示多边形不是简单多边形
+// （自交、退化等），此时 indices 的内容无意义
+bool TriangulatePolygon(const ImVec2* points, int count, std::vector<int>& indices, TriangulationScratch& scratch);
+
+// 三角化结果的缓存（LRU，容量按条目数限制）
+// 以顶点数据的哈希为键，命中后再逐个比较顶点，所以哈希冲突不会得到错误的结果；
+// 每帧都画同一个多边形时只在顶点变化后重新三角化
+struct TriangulationCache {
+    size_t capacity; // 最多缓存的条目数
+    size_t hits;
+    size_t misses;
+
+    explicit TriangulationCache(size_t capacity = 64);
+
+    // 返回多边形的三角形下标，三角化失败时返回空数组
+    // 返回的引用在下一次查询之前有效（之后可能被淘汰）
+    const std::vector<int>& Triangulate(const ImVec2* points, int count);
+
+    size_t EntryCount() const { return entries.size(); }
+
+    // 顶点和下标占用的字节数（不含容器自身的开销）
+    size_t MemoryBytes() const { return bytes; }
+
+    void Clear();
+
+private:
+    struct Entry {
+        uint64_t key;
+        std::vector<ImVec2> points;
+        std::vector<int> indices;
+    };
+
+    std::list<Entry> entries; // 最近使用的在前
+    std::unordered_multimap<uint64_t, std::list<Entry>::iterator> lookup;
+    size_t bytes;
+    TriangulationScratch scratch;
+};
+
+// 填充任意简单多边形（可以是凹的）：三角形直接写入 draw_list 的顶点和索引缓冲，不做抗锯齿
+// 顶点坐标相对 canvas_pos；三角化失败（例如自交）时退回 AddConvexPolyFilled
+void DrawPolygonFilledTriangulated(ImDrawList* draw_list,
+    ImVec2 canvas_pos,
+    const std::vector<ImVec2>& polygon,
+    ImU32 color,
+    TriangulationCache& cache);
+
+#endif // TRIANGULATE_H
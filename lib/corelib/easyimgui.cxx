@@ -3,6 +3,8 @@
 #include <imgui.h>
 #include <imgui_internal.h>
 
+#include <algorithm>
+#include <climits>
 #include <iostream>
 #include <vector>
 
@@ -41,6 +43,43 @@ void ShowWindowsInfos()
 
     ImGui::End();
 }
+void ShowConicOffsetCacheOverlay(const ConicOffsetCache& cache)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x - 10.0f, viewport->WorkPos.y + 10.0f), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowBgAlpha(0.35f);
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings
+        | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+    if (ImGui::Begin("Offset Cache", nullptr, flags)) {
+        size_t lookups = cache.hits + cache.misses;
+        ImGui::Text("Offset cache");
+        ImGui::Separator();
+        ImGui::Text("Hits: %zu  Misses: %zu", cache.hits, cache.misses);
+        ImGui::Text("Hit rate: %.1f%%", lookups > 0 ? 100.0 * cache.hits / lookups : 0.0);
+        ImGui::Text("Entries: %zu / %zu", cache.EntryCount(), cache.capacity);
+        ImGui::Text("Memory: %.1f KB", cache.MemoryBytes() / 1024.0);
+    }
+    ImGui::End();
+}
+
+void ShowRasterCacheOverlay(const RasterCache& cache)
+{
+    const ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x - 10.0f, viewport->WorkPos.y + 10.0f), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowBgAlpha(0.35f);
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings
+        | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+    if (ImGui::Begin("Raster Cache", nullptr, flags)) {
+        ImGui::Text("Raster cache");
+        ImGui::Separator();
+        ImGui::Text("Hits: %zu  Misses: %zu", cache.hits, cache.misses);
+        ImGui::Text("Hit rate: %.1f%%", 100.0 * cache.HitRate());
+        ImGui::Text("Entries: %zu", cache.EntryCount());
+        ImGui::Text("Memory: %.1f / %.1f KB", cache.MemoryBytes() / 1024.0, cache.budget / 1024.0);
+    }
+    ImGui::End();
+}
+
 // easyimgui.cxx
 void ArrangeWindowsDynamicGrid(int window_count, ImVec2 base_pos,
     ImVec2 window_size, int columns)
@@ -141,4 +180,199 @@ void CleanupGLFWAndImGui(GLFWwindow* window)
     ImGui::DestroyContext();
     glfwDestroyWindow(window);
     glfwTerminate();
-}
\ No newline at end of file
+}
+
+// 把包围矩形置为空
+static void ResetBandRect(int& x0, int& y0, int& x1, int& y1)
+{
+    x0 = y0 = INT_MAX;
+    x1 = y1 = -1;
+}
+
+PixelCanvas::PixelCanvas(int width, int height)
+    : texture(0)
+    , uploaded_bytes(0)
+    , clear_color(0)
+    , texture_width(0)
+    , texture_height(0)
+{
+    Resize(width, height);
+}
+
+void PixelCanvas::Resize(int width, int height)
+{
+    if (width == buffer.width && height == buffer.height)
+        return;
+
+    buffer.Resize(width, height);
+    buffer.Clear(clear_color);
+
+    int bands = (buffer.height + (1 << kBandShift) - 1) >> kBandShift;
+    dirty.resize(bands);
+    touched.resize(bands);
+    for (int i = 0; i < bands; ++i) {
+        ResetBandRect(dirty[i].x0, dirty[i].y0, dirty[i].x1, dirty[i].y1);
+        ResetBandRect(touched[i].x0, touched[i].y0, touched[i].x1, touched[i].y1);
+    }
+    MarkDirty(0, 0, buffer.width - 1, buffer.height - 1);
+}
+
+void PixelCanvas::Touch(int x0, int x1, int y)
+{
+    BandRect& d = dirty[y >> kBandShift];
+    d.x0 = std::min(d.x0, x0);
+    d.x1 = std::max(d.x1, x1);
+    d.y0 = std::min(d.y0, y);
+    d.y1 = std::max(d.y1, y);
+
+    BandRect& t = touched[y >> kBandShift];
+    t.x0 = std::min(t.x0, x0);
+    t.x1 = std::max(t.x1, x1);
+    t.y0 = std::min(t.y0, y);
+    t.y1 = std::max(t.y1, y);
+}
+
+void PixelCanvas::Plot(int x, int y, ImU32 color)
+{
+    if (!buffer.Contains(x, y))
+        return;
+    buffer.pixels[y * buffer.width + x] = color;
+    Touch(x, x, y);
+}
+
+void PixelCanvas::PlotSpan(int x0, int x1, int y, ImU32 color)
+{
+    if (y < 0 || y >= buffer.height)
+        return;
+    x0 = std::max(x0, 0);
+    x1 = std::min(x1, buffer.width - 1);
+    if (x0 > x1)
+        return;
+    buffer.PlotSpan(x0, x1, y, color);
+    Touch(x0, x1, y);
+}
+
+void PixelCanvas::PlotVSpan(int x, int y0, int y1, ImU32 color)
+{
+    if (x < 0 || x >= buffer.width)
+        return;
+    y0 = std::max(y0, 0);
+    y1 = std::min(y1, buffer.height - 1);
+    buffer.PlotVSpan(x, y0, y1, color);
+    for (int y = y0; y <= y1; ++y)
+        Touch(x, x, y);
+}
+
+void PixelCanvas::MarkDirty(int x0, int y0, int x1, int y1)
+{
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, buffer.width - 1);
+    y1 = std::min(y1, buffer.height - 1);
+    if (x0 > x1 || y0 > y1)
+        return;
+    GrowBandRects(dirty, x0, y0, x1, y1);
+}
+
+PixelBuffer* PixelCanvas::AsPixelBuffer(int x0, int y0, int x1, int y1)
+{
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, buffer.width - 1);
+    y1 = std::min(y1, buffer.height - 1);
+    if (x0 <= x1 && y0 <= y1) {
+        GrowBandRects(dirty, x0, y0, x1, y1);
+        GrowBandRects(touched, x0, y0, x1, y1);
+    }
+    return &buffer;
+}
+
+void PixelCanvas::GrowBandRects(std::vector<BandRect>& rects, int x0, int y0, int x1, int y1)
+{
+    for (int band = y0 >> kBandShift; band <= (y1 >> kBandShift); ++band) {
+        int bandTop = band << kBandShift;
+        int bandBottom = bandTop + (1 << kBandShift) - 1;
+        BandRect& r = rects[band];
+        r.x0 = std::min(r.x0, x0);
+        r.x1 = std::max(r.x1, x1);
+        r.y0 = std::min(r.y0, std::max(y0, bandTop));
+        r.y1 = std::max(r.y1, std::min(y1, bandBottom));
+    }
+}
+
+void PixelCanvas::Clear(ImU32 color)
+{
+    // 背景色变了，只能整张重画
+    if (color != clear_color) {
+        clear_color = color;
+        buffer.Clear(color);
+        for (BandRect& t : touched)
+            ResetBandRect(t.x0, t.y0, t.x1, t.y1);
+        MarkDirty(0, 0, buffer.width - 1, buffer.height - 1);
+        return;
+    }
+
+    // 只擦除画过的区域
+    for (BandRect& t : touched) {
+        if (t.x0 > t.x1)
+            continue;
+        for (int y = t.y0; y <= t.y1; ++y) {
+            buffer.PlotSpan(t.x0, t.x1, y, color);
+        }
+        MarkDirty(t.x0, t.y0, t.x1, t.y1);
+        ResetBandRect(t.x0, t.y0, t.x1, t.y1);
+    }
+}
+
+void PixelCanvas::Show()
+{
+    uploaded_bytes = 0;
+    if (buffer.width == 0 || buffer.height == 0)
+        return;
+
+    if (texture == 0) {
+        glGenTextures(1, &texture);
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    if (texture_width != buffer.width || texture_height != buffer.height) {
+        // 尺寸变化：重新分配纹理并整张上传
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, buffer.width, buffer.height, 0,
+            GL_RGBA, GL_UNSIGNED_BYTE, buffer.pixels.data());
+        texture_width = buffer.width;
+        texture_height = buffer.height;
+        uploaded_bytes = buffer.width * buffer.height * 4;
+        for (BandRect& d : dirty)
+            ResetBandRect(d.x0, d.y0, d.x1, d.y1);
+    } else {
+        // 只上传每条带的脏矩形，用 GL_UNPACK_ROW_LENGTH 直接从整张缓冲中取子区域
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, buffer.width);
+        for (BandRect& d : dirty) {
+            if (d.x0 > d.x1)
+                continue;
+            int w = d.x1 - d.x0 + 1;
+            int h = d.y1 - d.y0 + 1;
+            glTexSubImage2D(GL_TEXTURE_2D, 0, d.x0, d.y0, w, h, GL_RGBA, GL_UNSIGNED_BYTE,
+                buffer.pixels.data() + static_cast<size_t>(d.y0) * buffer.width + d.x0);
+            uploaded_bytes += w * h * 4;
+            ResetBandRect(d.x0, d.y0, d.x1, d.y1);
+        }
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+
+    ImGui::Image((ImTextureID)(intptr_t)texture, ImVec2((float)buffer.width, (float)buffer.height));
+}
+
+void PixelCanvas::Release()
+{
+    if (texture != 0) {
+        glDeleteTextures(1, &texture);
+        texture = 0;
+    }
+    texture_width = texture_height = 0;
+}
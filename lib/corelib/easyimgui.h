@@ -2,7 +2,11 @@
 #define EASYIMGUI_H
 
 #include "imgui.h"
+#include "ConicOffsetCache.h"
+#include "RasterCache.h"
+#include "RasterTarget.h"
 #include <GLFW/glfw3.h>
+#include <vector>
 // Struct to store window information
 struct WindowInfo {
     const char* name; // Window name
@@ -13,6 +17,12 @@ struct WindowInfo {
 // Function to display all window information
 void ShowWindowsInfos();
 
+// 在窗口右上角显示偏移表缓存的命中率和内存占用
+void ShowConicOffsetCacheOverlay(const ConicOffsetCache& cache);
+
+// 在窗口右上角显示光栅化结果缓存的命中率和内存占用
+void ShowRasterCacheOverlay(const RasterCache& cache);
+
 void ArrangeWindowsDynamicGrid(int window_count, ImVec2 base_pos = ImVec2(50, 50), ImVec2 window_size = ImVec2(300, 200), int columns = 3);
 
 // 初始化 GLFW 和 ImGui，并返回一个初始化后的 GLFW 窗口
@@ -38,4 +48,55 @@ struct ControlPoint {
     }
 };
 
+// 像素画布：在 CPU 缓冲中光栅化，整张画布只用一个 ImGui::Image 四边形显示
+// 画布按行分成若干条带，每条带记录自己的脏矩形，每帧只用 glTexSubImage2D 上传脏矩形
+// 纹理在第一次 Show() 时创建，需在 OpenGL 上下文销毁前调用 Release()
+struct PixelCanvas : RasterTarget {
+    PixelBuffer buffer;
+    unsigned int texture; // OpenGL 纹理 ID，0 表示尚未创建
+    int uploaded_bytes; // 上一次 Show() 上传的字节数
+
+    PixelCanvas(int width = 0, int height = 0);
+
+    // 尺寸变化时重新分配缓冲和纹理，整张画布标记为脏
+    void Resize(int width, int height);
+
+    // 清空画布：只擦除上次清空后画过的区域，避免每帧整张重新上传
+    void Clear(ImU32 color = 0);
+
+    void Plot(int x, int y, ImU32 color) override;
+    void PlotSpan(int x0, int x1, int y, ImU32 color) override;
+    void PlotVSpan(int x, int y0, int y1, ImU32 color) override;
+    bool GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const override { return buffer.GetClipRect(xmin, ymin, xmax, ymax); }
+
+    // 直接写 buffer 的算法先把要写的矩形记为脏区域
+    PixelBuffer* AsPixelBuffer(int x0, int y0, int x1, int y1) override;
+
+    // 标记 [x0, x1] x [y0, y1] 需要重新上传（例如直接修改了 buffer.pixels）
+    void MarkDirty(int x0, int y0, int x1, int y1);
+
+    // 上传脏矩形并在当前光标位置显示画布
+    void Show();
+
+    void Release();
+
+private:
+    static const int kBandShift = 6; // 每条带 64 行
+
+    // 一条带内的包围矩形，x0 > x1 表示为空
+    struct BandRect {
+        int x0, y0, x1, y1;
+    };
+
+    std::vector<BandRect> dirty; // 自上次上传后改动过的区域
+    std::vector<BandRect> touched; // 自上次清空后画过的区域
+    ImU32 clear_color;
+    int texture_width, texture_height;
+
+    void Touch(int x0, int x1, int y);
+
+    // 把 [x0, x1] x [y0, y1]（已限制在画布内）并入每条带的包围矩形
+    static void GrowBandRects(std::vector<BandRect>& rects, int x0, int y0, int x1, int y1);
+};
+
 #endif // EASYIMGUI_H
\ No newline at end of file
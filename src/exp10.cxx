@@ -1,7 +1,9 @@
 #include "Algorithm.h" // 引入算法文件
+#include "LineClip.h" // 批量直线裁剪
 #include "easyimgui.h" // 引入 EasyImGui 库
 #include <GLFW/glfw3.h>
 #include <imgui.h>
+#include <algorithm>
 #include <cmath>
 
 struct Line {
@@ -24,6 +26,8 @@ int main()
 
     const float point_radius = 6.0f; // 拖拽点的半径
     bool show_control_window = true;
+    int clip_algorithm = LINE_CLIP_COHEN_SUTHERLAND; // 裁剪算法
+    LineSegmentsSoA segments, clipped; // 批量裁剪接口的输入和输出
     bool dragging_point = false;    // 标记是否在拖拽
     int dragged_point = -1;         // 被拖拽的点的索引（0：窗口左上，1：窗口右下，2：线段起点，3：线段终点）
 
@@ -106,13 +110,19 @@ int main()
             dragged_point = -1;
         }
 
-        // 裁剪直线
-        float x0 = line.x0, y0 = line.y0, x1 = line.x1, y1 = line.y1;
-        if (CohenSutherlandLineClip(x0, y0, x1, y1, clipWindow.x0, clipWindow.y0,
-                clipWindow.x1, clipWindow.y1)) {
+        // 裁剪直线：通过批量接口，运行时切换算法；拖拽时两个角点可能交换，先整理成 min / max
+        LineClipWindow lineWindow;
+        lineWindow.xmin = std::min(clipWindow.x0, clipWindow.x1);
+        lineWindow.ymin = std::min(clipWindow.y0, clipWindow.y1);
+        lineWindow.xmax = std::max(clipWindow.x0, clipWindow.x1);
+        lineWindow.ymax = std::max(clipWindow.y0, clipWindow.y1);
+        segments.Clear();
+        segments.Add(ImVec2(line.x0, line.y0), ImVec2(line.x1, line.y1));
+        ClipLines(static_cast<LineClipAlgorithm>(clip_algorithm), segments, lineWindow, clipped);
+        for (size_t i = 0; i < clipped.Size(); ++i) {
             // 绘制裁剪后的直线
-            draw_list->AddLine(ImVec2(canvas_pos.x + x0, canvas_pos.y + y0),
-                ImVec2(canvas_pos.x + x1, canvas_pos.y + y1),
+            draw_list->AddLine(ImVec2(canvas_pos.x + clipped.x0[i], canvas_pos.y + clipped.y0[i]),
+                ImVec2(canvas_pos.x + clipped.x1[i], canvas_pos.y + clipped.y1[i]),
                 ImColor(afterColor), 2.0f);
         }
 
@@ -126,6 +136,10 @@ int main()
             ImGui::ColorEdit3("Before Clipping", (float*)&beforeColor);
             ImGui::ColorEdit3("After Clipping", (float*)&afterColor);
 
+            ImGui::Text("Clipping Algorithm:");
+            for (int algorithm = LINE_CLIP_COHEN_SUTHERLAND; algorithm <= LINE_CLIP_CYRUS_BECK; ++algorithm)
+                ImGui::RadioButton(LineClipAlgorithmName(static_cast<LineClipAlgorithm>(algorithm)), &clip_algorithm, algorithm);
+
             ImGui::Text("Clipping Window:");
             ImGui::InputFloat("Top Left x", &clipWindow.x0);
             ImGui::InputFloat("Top Left y", &clipWindow.y0);
@@ -1,4 +1,5 @@
 #include "Algorithm.h" // 引入算法文件
+#include "PolygonClip.h"
 #include "easyimgui.h" // 引入 EasyImGui 库
 #include <GLFW/glfw3.h>
 #include <imgui.h>
@@ -23,6 +24,10 @@ int main() {
 
     int draggedVertex = -1; // 当前被拖拽的顶点索引
 
+    // 裁剪结果和中间缓冲在各帧之间复用
+    std::vector<ImVec2> clippedPolygon;
+    PolygonClipScratch clipScratch;
+
     // 主循环
     while (!glfwWindowShouldClose(window)) {
         glfwPollEvents();
@@ -75,7 +80,7 @@ int main() {
         }
 
         // 裁剪多边形
-        std::vector<ImVec2> clippedPolygon = SutherlandHodgmanPolygonClip(polygon, clipWindow);
+        ClipPolygonSutherlandHodgman(polygon.data(), static_cast<int>(polygon.size()), clipWindow, clippedPolygon, clipScratch);
 
         // 绘制裁剪后的多边形
         DrawPolygon(draw_list, canvas_pos, clippedPolygon, ImColor(clippedPolygonColor));
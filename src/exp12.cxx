@@ -1,6 +1,7 @@
 // main.cpp 
 // Failed
 #include "Algorithm.h"
+#include "Triangulate.h"
 #include "easyimgui.h"
 #include <imgui_internal.h>
 #include <GLFW/glfw3.h>
@@ -46,6 +47,8 @@ int main()
     };
     ClipWindow clipWindow = {100.0f, 150.0f, 350.0f, 400.0f}; // 初始裁剪窗口
 
+    TriangulationCache triangulationCache; // 裁剪结果的三角化缓存
+
     // 拖拽状态变量
     int draggedVertex = -1; // 被拖拽的多边形顶点索引，-1 表示未拖拽
     bool draggingTopLeft = false, draggingBottomRight = false; // 是否正在拖拽裁剪窗口的两个对角点
@@ -67,7 +70,7 @@ int main()
         ImGui::ColorEdit3("Clip Window Color", (float*)&clipColor);
 
         static int vertexCount = subjectPolygon.size();
-        if (ImGui::SliderInt("Vertex Count", &vertexCount, 3, 8)) {
+        if (ImGui::SliderInt("Vertex Count", &vertexCount, 3, 8192, "%d", ImGuiSliderFlags_Logarithmic)) {
             if (vertexCount < subjectPolygon.size()) {
                 subjectPolygon.resize(vertexCount);
             }
@@ -79,6 +82,16 @@ int main()
             }
         }
 
+        // 生成有 vertexCount 个顶点的星形多边形，用来测试顶点很多时的裁剪
+        if (ImGui::Button("Star Polygon")) {
+            subjectPolygon.resize(vertexCount);
+            for (int i = 0; i < vertexCount; ++i) {
+                float angle = 6.2831853f * i / vertexCount;
+                float radius = (i % 2 == 0) ? 200.0f : 120.0f + 60.0f * std::sin(angle * 7.0f);
+                subjectPolygon[i] = ImVec2(300.0f + radius * std::cos(angle), 250.0f + radius * std::sin(angle));
+            }
+        }
+
         ImGui::End();
 
         // 主裁剪窗口
@@ -116,9 +129,11 @@ int main()
         // 绘制主多边形
         DrawPolygon(draw_list, canvas_pos, subjectPolygon, ImColor(subjectColor), 2.0f);
 
-        // 绘制多边形的拖拽点
-        for (const auto& vertex : subjectPolygon) {
-            DrawDragPoint(draw_list, vertex, canvas_pos, IM_COL32(0, 255, 0, 255));
+        // 绘制多边形的拖拽点（顶点太多时不画，否则会盖住整个多边形）
+        if (subjectPolygon.size() <= 64) {
+            for (const auto& vertex : subjectPolygon) {
+                DrawDragPoint(draw_list, vertex, canvas_pos, IM_COL32(0, 255, 0, 255));
+            }
         }
 
         // 进行裁剪
@@ -129,21 +144,11 @@ int main()
             if (poly.size() < 3)
                 continue; // 忽略非法多边形
 
-            // 填充多边形
-            draw_list->AddConvexPolyFilled(
-                poly.data(),
-                poly.size(),
-                ImColor(overlapColor)
-            );
-
-            // 绘制多边形边界
-            draw_list->AddPolyline(
-                poly.data(),
-                poly.size(),
-                IM_COL32(255, 0, 0, 255),
-                true,
-                2.0f
-            );
+            // 填充多边形：裁剪结果可能是凹的，三角化后再填充（顶点不变时直接使用缓存的三角形）
+            DrawPolygonFilledTriangulated(draw_list, canvas_pos, poly, ImColor(overlapColor), triangulationCache);
+
+            // 绘制多边形边界（裁剪结果的坐标相对画布）
+            DrawPolygon(draw_list, canvas_pos, poly, IM_COL32(255, 0, 0, 255), 2.0f);
         }
 
         ImGui::End();
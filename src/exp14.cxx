@@ -1,5 +1,6 @@
 #include <glad.h>
 #include "Algorithm.h"
+#include "FrustumClip.h"
 #include "easyimgui.h"
 #include <GLFW/glfw3.h>
 #include <cmath>
@@ -55,8 +56,13 @@ struct ProjectionParameters {
   float delta = 0.0f;       // Rotation around Z-axis
   Vec3 prp = Vec3(0, 0, 1000); // Projection Reference Point (PRP)
   ImVec2 cw = ImVec2(400, 300); // Window Center (CW) - Adjusted for centering
+  bool fillFaces = false;       // Draw translucent faces under the wireframe
 };
 
+// Depth range of the view volume, measured along the viewing direction
+const float kNearPlane = 1.0f;
+const float kFarPlane = 100000.0f;
+
 // Function to apply rotation (combined rotation around all axes)
 Vec3 RotateVertex(const Vec3 &vertex, float theta, float phi, float delta) {
   // Apply rotations around each axis
@@ -66,17 +72,29 @@ Vec3 RotateVertex(const Vec3 &vertex, float theta, float phi, float delta) {
   return rotated;
 }
 
-// Function to apply perspective projection with respect to the PRP
-ImVec2 ProjectVertex(const Vec3 &vertex, const ProjectionParameters &params) {
+// Map a vertex to homogeneous clip space for a canvas of the given size.
+// The projection is the same as the old raw divide by (d + z - prp.z), with
+// the sign of w chosen so that w > 0 in front of the PRP. The canvas maps to
+// -w <= x, y <= w and [near, far] to -w <= z <= w, so geometry can be clipped
+// against the frustum before the perspective divide.
+ImVec4 ToClipSpace(const Vec3 &vertex, const ProjectionParameters &params,
+                   const ImVec2 &size) {
+  float sx, sy, w, z; // Canvas position times w, and clip-space z
   if (params.perspective) {
     float d = params.prp.z; // Use PRP's z-coordinate as the distance
-    return ImVec2(
-        d * (vertex.x - params.prp.x) / (d + vertex.z - params.prp.z) + params.cw.x,
-        d * (vertex.y - params.prp.y) / (d + vertex.z - params.prp.z) + params.cw.y
-    );
+    w = -(d + vertex.z - params.prp.z);
+    sx = -d * (vertex.x - params.prp.x) + params.cw.x * w;
+    sy = -d * (vertex.y - params.prp.y) + params.cw.y * w;
+    z = ((kFarPlane + kNearPlane) * w - 2.0f * kFarPlane * kNearPlane) /
+        (kFarPlane - kNearPlane);
   } else {
-    return ImVec2(vertex.x + params.cw.x, vertex.y + params.cw.y);
+    w = 1.0f;
+    sx = vertex.x + params.cw.x;
+    sy = vertex.y + params.cw.y;
+    z = -vertex.z / kFarPlane;
   }
+  return ImVec4((2.0f * sx - size.x * w) / size.x,
+                (2.0f * sy - size.y * w) / size.y, z, w);
 }
 
 // Function to draw a line between two points
@@ -119,6 +137,8 @@ void DrawControlPanel(ProjectionParameters &params) {
   ImGui::SliderFloat2("CW", (float *)&params.cw, -500.0f,
                       500.0f); // Make sure to adjust this accordingly
 
+  ImGui::Checkbox("Fill Faces", &params.fillFaces);
+
   // Apply and Restore buttons
   if (ImGui::Button("Apply")) {
     // Apply changes
@@ -149,23 +169,57 @@ void Draw3DHouse(ImDrawList *draw_list, const ImVec2 &canvas_pos,
     vertex.z += params.vrp.z;
   }
 
-  // Project vertices to 2D
-  std::vector<ImVec2> projectedVertices;
+  // Transform vertices to clip space; the canvas is the rest of the window
+  ImVec2 size = ImGui::GetContentRegionAvail();
+  if (size.x <= 0.0f || size.y <= 0.0f)
+    return;
+  std::vector<ImVec4> clipVertices;
   for (const auto &vertex : vertices) {
-    projectedVertices.push_back(ProjectVertex(vertex, params));
+    clipVertices.push_back(ToClipSpace(vertex, params, size));
+  }
+  FrustumViewport viewport = {0.0f, 0.0f, size.x, size.y};
+
+  // Reused across frames by the clipper
+  static FrustumClipScratch scratch;
+  static std::vector<ImVec2> clipped;
+
+  // Faces, clipped to the frustum and split into triangles
+  if (params.fillFaces) {
+    static const int faces[] = {
+        0, 1, 2, 0, 2, 3, // Base
+        4, 5, 6, 4, 6, 7, // Top
+        0, 1, 5, 0, 5, 4, 1, 2, 6, 1, 6, 5, // Sides
+        2, 3, 7, 2, 7, 6, 3, 0, 4, 3, 4, 7,
+        3, 2, 8, 7, 6, 8, 3, 7, 8, 2, 6, 8 // Roof
+    };
+    size_t count = ClipProjectTriangles(clipVertices.data(),
+                                        (int)clipVertices.size(), faces,
+                                        (int)(sizeof(faces) / sizeof(faces[0]) / 3),
+                                        viewport, clipped, scratch);
+    for (size_t i = 0; i < count; ++i) {
+      draw_list->AddTriangleFilled(clipped[3 * i] + canvas_pos,
+                                   clipped[3 * i + 1] + canvas_pos,
+                                   clipped[3 * i + 2] + canvas_pos,
+                                   IM_COL32(100, 150, 255, 60));
+    }
   }
 
   // Draw the wireframe of the house
-  std::vector<std::pair<int, int>> edges = {
-      {0, 1}, {1, 2}, {2, 3}, {3, 0}, // Base
-      {4, 5}, {5, 6}, {6, 7}, {7, 4}, // Top
-      {0, 4}, {1, 5}, {2, 6}, {3, 7}, // Sides
-      {3, 8}, {2, 8}, {7, 8}, {6, 8}  // Roof
+  static const int edges[] = {
+      0, 1, 1, 2, 2, 3, 3, 0, // Base
+      4, 5, 5, 6, 6, 7, 7, 4, // Top
+      0, 4, 1, 5, 2, 6, 3, 7, // Sides
+      3, 8, 2, 8, 7, 8, 6, 8  // Roof
   };
 
-  for (const auto &edge : edges) {
-    DrawLine(draw_list, canvas_pos, projectedVertices[edge.first],
-             projectedVertices[edge.second], IM_COL32(255, 255, 255, 255));
+  // Edges are clipped before the divide, so vertices behind the PRP no longer
+  // turn into huge lines; an off-screen house is rejected by its outcodes
+  size_t count = ClipProjectLines(clipVertices.data(), (int)clipVertices.size(),
+                                  edges, (int)(sizeof(edges) / sizeof(edges[0]) / 2),
+                                  viewport, clipped, scratch);
+  for (size_t i = 0; i < count; ++i) {
+    DrawLine(draw_list, canvas_pos, clipped[2 * i], clipped[2 * i + 1],
+             IM_COL32(255, 255, 255, 255));
   }
 }
 
@@ -1,4 +1,5 @@
 #include "easyimgui.h"
+#include "Algorithm.h" // 包含绘制算法
 #include <iostream>
 #include "imgui.h"
 #include <cmath> // 用于绝对值函数
@@ -12,30 +13,6 @@ struct LineParams {
 };
 
 
-void DrawLineDDA(ImDrawList* draw_list, ImVec2 start, ImVec2 end, ImU32 color, float radius = 1.0f) {
-    // 计算增量
-    float dx = end.x - start.x;
-    float dy = end.y - start.y;
-
-    // 确定步数（绝对值更大的轴方向决定步数）
-    float steps = std::max(std::abs(dx), std::abs(dy));
-
-    // 计算每一步的增量
-    float x_inc = dx / steps;
-    float y_inc = dy / steps;
-
-    // 起始点
-    float x = start.x;
-    float y = start.y;
-
-    // 绘制每一个点（用圆形代替矩形）
-    for (int i = 0; i <= steps; i++) {
-        draw_list->AddCircleFilled(ImVec2(x, y), radius, color); // 绘制一个圆形点
-        x += x_inc; // 更新 X 坐标
-        y += y_inc; // 更新 Y 坐标
-    }
-}
-
 int main() {
     // 初始化 GLFW 和 ImGui
     GLFWwindow* window = InitGLFWAndImGui("exp2: DrawLineDDA", 1400, 900);
@@ -46,6 +23,9 @@ int main() {
     bool show_control_window = true;
     bool show_draw_window = true;
     bool show_windows_infos = true;
+    bool use_batched = false; // 批量四边形模式
+    bool use_fixed = false; // 32.32 定点 DDA
+    int line_vertices = 0; // 本帧直线产生的顶点数
 
     // 主循环
     while (!glfwWindowShouldClose(window)) {
@@ -65,12 +45,19 @@ int main() {
             ImVec2 p1 = ImVec2(canvas_pos.x + lineParams.x0, canvas_pos.y + lineParams.y0);
             ImVec2 p2 = ImVec2(canvas_pos.x + lineParams.x1, canvas_pos.y + lineParams.y1);
 
-            // 使用 DDA 算法绘制直线
-            DrawLineDDA(draw_list, p1, p2, ImColor(lineParams.color),5.0f);
+            // 使用 DDA 算法绘制直线，并统计产生的顶点数
+            int vtx_before = draw_list->VtxBuffer.Size;
+            if (use_fixed)
+                DrawLineDDAFixed(draw_list, p1, p2, ImColor(lineParams.color), 5.0f,
+                                 use_batched ? PIXEL_QUAD : PIXEL_CIRCLE);
+            else
+                DrawLineDDA(draw_list, p1, p2, ImColor(lineParams.color), 5.0f,
+                            use_batched ? PIXEL_QUAD : PIXEL_CIRCLE);
+            line_vertices = draw_list->VtxBuffer.Size - vtx_before;
 
             if (show_control_window) {
                 ImGui::Begin("Parameter Settings", &show_control_window);
-                ImGui::SetWindowSize(ImVec2(350, 200));
+                ImGui::SetWindowSize(ImVec2(350, 260));
                 ImGui::Text("Line Color:");
                 ImGui::ColorEdit3("##lineColor", (float*)&lineParams.color);
 
@@ -79,6 +66,12 @@ int main() {
                 ImGui::SliderFloat("End Point x1:", &lineParams.x1, 0.0f, canvas_size.x);
                 ImGui::SliderFloat("End Point y1:", &lineParams.y1, 0.0f, canvas_size.y);
 
+                // 批量模式与逐像素画圆的对比
+                ImGui::Checkbox("Batched Quads (PrimReserve)", &use_batched);
+                ImGui::Checkbox("Fixed-Point DDA (32.32)", &use_fixed);
+                ImGui::Text("Line vertices: %d", line_vertices);
+                ImGui::Text("Frame time: %.3f ms (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+
                 if (ImGui::Button("Confirm")) {
                     std::cout << "Parameters confirmed: "
                               << "Start(" << lineParams.x0 << ", " << lineParams.y0 << "), "
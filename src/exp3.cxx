@@ -23,6 +23,8 @@ int main() {
     bool show_windows_infos = true;
     bool use_dda = false; // 控制使用哪种算法
     float point_radius = 2.0f; // 圆形半径
+    bool use_batched = false; // 批量四边形模式
+    int line_vertices = 0; // 本帧直线产生的顶点数
 
     // 主循环
     while (!glfwWindowShouldClose(window)) {
@@ -40,16 +42,19 @@ int main() {
             ImVec2 p1 = ImVec2(canvas_pos.x + lineParams.x0, canvas_pos.y + lineParams.y0);
             ImVec2 p2 = ImVec2(canvas_pos.x + lineParams.x1, canvas_pos.y + lineParams.y1);
 
-            // 根据用户选择调用 DDA 或中点算法
+            // 根据用户选择调用 DDA 或中点算法，并统计产生的顶点数
+            PixelStyle style = use_batched ? PIXEL_QUAD : PIXEL_CIRCLE;
+            int vtx_before = draw_list->VtxBuffer.Size;
             if (use_dda) {
-                DrawLineDDA(draw_list, p1, p2, ImColor(lineParams.color), point_radius);
+                DrawLineDDA(draw_list, p1, p2, ImColor(lineParams.color), point_radius, style);
             } else {
-                DrawLineMidpoint(draw_list, p1, p2, ImColor(lineParams.color), point_radius);
+                DrawLineMidpoint(draw_list, p1, p2, ImColor(lineParams.color), point_radius, style);
             }
+            line_vertices = draw_list->VtxBuffer.Size - vtx_before;
 
             if (show_control_window) {
                 ImGui::Begin("Parameter Settings", &show_control_window);
-                ImGui::SetWindowSize(ImVec2(350, 200));
+                ImGui::SetWindowSize(ImVec2(350, 300));
 
                 ImGui::Text("Line Color:");
                 ImGui::ColorEdit3("##lineColor", (float*)&lineParams.color);
@@ -64,6 +69,11 @@ int main() {
                 // 添加算法选择控件
                 ImGui::Checkbox("Use DDA Algorithm", &use_dda);
 
+                // 批量模式与逐像素画圆的对比
+                ImGui::Checkbox("Batched Quads (PrimReserve)", &use_batched);
+                ImGui::Text("Line vertices: %d", line_vertices);
+                ImGui::Text("Frame time: %.3f ms (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+
                 if (ImGui::Button("Confirm")) {
                     std::cout << "Parameters confirmed: "
                               << "Start(" << lineParams.x0 << ", " << lineParams.y0 << "), "
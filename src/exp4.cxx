@@ -23,6 +23,9 @@ int main() {
     bool show_draw_window = true;
     bool show_windows_infos = true;
     float point_radius = 2.0f; // 圆形半径
+    bool use_batched = false; // 批量四边形模式
+    bool use_run_slice = false; // 按游程输出（每段连续像素一个四边形）
+    int line_vertices = 0; // 本帧直线产生的顶点数
 
     // 主循环
     while (!glfwWindowShouldClose(window)) {
@@ -40,12 +43,20 @@ int main() {
             ImVec2 p1 = ImVec2(canvas_pos.x + lineParams.x0, canvas_pos.y + lineParams.y0);
             ImVec2 p2 = ImVec2(canvas_pos.x + lineParams.x1, canvas_pos.y + lineParams.y1);
 
-            // 使用 Bresenham 算法绘制直线
-            DrawLineBresenham(draw_list, p1, p2, ImColor(lineParams.color), point_radius);
+            // 使用 Bresenham 算法绘制直线，并统计产生的顶点数
+            int vtx_before = draw_list->VtxBuffer.Size;
+            if (use_run_slice) {
+                DrawLineBresenhamRunSlice(draw_list, p1, p2, ImColor(lineParams.color), point_radius,
+                                          use_batched ? PIXEL_QUAD : PIXEL_CIRCLE);
+            } else {
+                DrawLineBresenham(draw_list, p1, p2, ImColor(lineParams.color), point_radius,
+                                  use_batched ? PIXEL_QUAD : PIXEL_CIRCLE);
+            }
+            line_vertices = draw_list->VtxBuffer.Size - vtx_before;
 
             if (show_control_window) {
                 ImGui::Begin("Parameter Settings", &show_control_window);
-                ImGui::SetWindowSize(ImVec2(350, 200));
+                ImGui::SetWindowSize(ImVec2(350, 300));
 
                 ImGui::Text("Line Color:");
                 ImGui::ColorEdit3("##lineColor", (float*)&lineParams.color);
@@ -57,6 +68,12 @@ int main() {
 
                 ImGui::SliderFloat("Point Radius", &point_radius, 1.0f, 10.0f, "Radius: %.1f");
 
+                // 批量模式与逐像素绘制的对比
+                ImGui::Checkbox("Batched Quads (PrimReserve)", &use_batched);
+                ImGui::Checkbox("Run-Slice (one span per run)", &use_run_slice);
+                ImGui::Text("Line vertices: %d", line_vertices);
+                ImGui::Text("Frame time: %.3f ms (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+
                 if (ImGui::Button("Confirm")) {
                     std::cout << "Parameters confirmed: "
                               << "Start(" << lineParams.x0 << ", " << lineParams.y0 << "), "
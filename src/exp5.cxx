@@ -19,6 +19,9 @@ int main() {
 
     bool show_control_window = true;
     bool show_draw_window = true;
+    bool filled = false; // 按扫描线填充
+    bool use_cache = true; // 复用同样大小图形的偏移表
+    ConicOffsetCache offset_cache(32);
 
     // 主循环
     while (!glfwWindowShouldClose(window)) {
@@ -36,11 +39,16 @@ int main() {
             ImVec2 center = ImVec2(canvas_pos.x + circleParams.centerX, canvas_pos.y + circleParams.centerY);
 
             // 使用中点画圆算法绘制圆
-            DrawCircleMidpoint(draw_list, center, circleParams.radius, ImColor(circleParams.color));
+            if (filled)
+                DrawCircleFilledMidpoint(draw_list, center, circleParams.radius, ImColor(circleParams.color));
+            else if (use_cache)
+                DrawCircleMidpointCached(draw_list, center, circleParams.radius, ImColor(circleParams.color), offset_cache);
+            else
+                DrawCircleMidpoint(draw_list, center, circleParams.radius, ImColor(circleParams.color));
 
             if (show_control_window) {
                 ImGui::Begin("Parameter Settings", &show_control_window);
-                ImGui::SetWindowSize(ImVec2(350, 200));
+                ImGui::SetWindowSize(ImVec2(350, 260));
 
                 // 调整圆参数
                 ImGui::Text("Circle Color:");
@@ -50,6 +58,9 @@ int main() {
                 ImGui::InputFloat("Center Y:", &circleParams.centerY);
                 ImGui::SliderInt("Radius:", &circleParams.radius, 1, 300, "Radius: %d");
 
+                ImGui::Checkbox("Filled (one span per scanline)", &filled);
+                ImGui::Checkbox("Offset Cache", &use_cache);
+
                 if (ImGui::Button("Confirm")) {
                     std::cout << "Parameters confirmed: "
                               << "Center(" << circleParams.centerX << ", " << circleParams.centerY << "), "
@@ -61,6 +72,8 @@ int main() {
             ImGui::End();
         }
 
+        if (use_cache)
+            ShowConicOffsetCacheOverlay(offset_cache);
         EndImGuiFrame(window); // 结束当前帧并交换缓冲区
     }
 
@@ -22,6 +22,9 @@ int main()
 
     bool show_control_window = true;
     bool show_draw_window = true;
+    bool filled = false; // 按扫描线填充
+    bool use_cache = true; // 复用同样大小图形的偏移表
+    ConicOffsetCache offset_cache(32);
 
     // 主循环
     while (!glfwWindowShouldClose(window)) {
@@ -39,11 +42,16 @@ int main()
             ImVec2 center = ImVec2(canvas_pos.x + ellipseParams.centerX, canvas_pos.y + ellipseParams.centerY);
 
             // 使用中点画椭圆算法绘制椭圆
-            DrawEllipseMidpoint(draw_list, center, ellipseParams.a, ellipseParams.b, ImColor(ellipseParams.color));
+            if (filled)
+                DrawEllipseFilledMidpoint(draw_list, center, ellipseParams.a, ellipseParams.b, ImColor(ellipseParams.color));
+            else if (use_cache)
+                DrawEllipseMidpointCached(draw_list, center, ellipseParams.a, ellipseParams.b, ImColor(ellipseParams.color), offset_cache);
+            else
+                DrawEllipseMidpoint(draw_list, center, ellipseParams.a, ellipseParams.b, ImColor(ellipseParams.color));
 
             if (show_control_window) {
                 ImGui::Begin("Parameter Settings", &show_control_window);
-                ImGui::SetWindowSize(ImVec2(350, 250));
+                ImGui::SetWindowSize(ImVec2(350, 310));
 
                 // 调整椭圆参数
                 ImGui::Text("Ellipse Color:");
@@ -54,6 +62,9 @@ int main()
                 ImGui::SliderInt("Semi-major Axis (a):", &ellipseParams.a, 1, 300, "a: %d");
                 ImGui::SliderInt("Semi-minor Axis (b):", &ellipseParams.b, 1, 300, "b: %d");
 
+                ImGui::Checkbox("Filled (one span per scanline)", &filled);
+                ImGui::Checkbox("Offset Cache", &use_cache);
+
                 if (ImGui::Button("Confirm")) {
                     std::cout << "Parameters confirmed: "
                               << "Center(" << ellipseParams.centerX << ", " << ellipseParams.centerY << "), "
@@ -65,6 +76,8 @@ int main()
             ImGui::End();
         }
         ShowWindowsInfos();
+        if (use_cache)
+            ShowConicOffsetCacheOverlay(offset_cache);
         EndImGuiFrame(window); // 结束当前帧并交换缓冲区
     }
 
@@ -1,4 +1,7 @@
 #include "Algorithm.h" // 导入算法相关头文件
+#include "CoverageFill.h" // 解析覆盖率抗锯齿填充
+#include "RasterCache.h" // 光栅化结果缓存
+#include "ScanlineFill.h" // 场景填充
 #include "easyimgui.h" // 导入自定义的 EasyImGui 库
 #include <cstdio>
 #include <imgui.h> // 导入 ImGui 库
@@ -19,6 +22,29 @@ struct PolygonParams {
     }
 };
 
+// 由多边形构建一个场景：外轮廓加上按质心缩小一半的内轮廓
+// 奇偶规则下内轮廓总是洞；非零规则下只有反向的内轮廓才是洞
+static void BuildHoleScene(FillScene& scene, const PolygonParams& params, ImU32 color, FillRule rule, bool reverse_hole)
+{
+    int n = params.vertexCount;
+    float cx = 0.0f, cy = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        cx += params.x[i] / n;
+        cy += params.y[i] / n;
+    }
+    std::vector<float> hx(n), hy(n);
+    for (int i = 0; i < n; ++i) {
+        int k = reverse_hole ? n - 1 - i : i;
+        hx[i] = cx + 0.5f * (params.x[k] - cx);
+        hy[i] = cy + 0.5f * (params.y[k] - cy);
+    }
+
+    scene.Clear();
+    int fill = scene.AddFill(color, rule);
+    scene.AddContour(fill, params.x.data(), params.y.data(), n);
+    scene.AddContour(fill, hx.data(), hy.data(), n);
+}
+
 int main()
 {
     // 初始化 GLFW 和 ImGui，创建一个窗口
@@ -33,6 +59,17 @@ int main()
     polygonParams.y = { 250.0f, 323.0f, 323.0f, 250.0f, 177.0f, 177.0f };
     
     bool show_control_window = true; // 控制面板是否显示
+    bool use_cpu_canvas = false; // 是否在 CPU 像素画布中光栅化
+    bool needs_redraw = true; // 多边形参数改变后才需要重新光栅化
+    PixelCanvas pixel_canvas; // CPU 像素画布
+    bool use_scene = false; // 是否加上内轮廓，用场景填充绘制
+    int fill_rule = FILL_EVEN_ODD; // 场景填充规则
+    bool reverse_hole = true; // 内轮廓是否反向
+    FillScene scene;
+    bool antialiased = false; // 是否用解析覆盖率做抗锯齿填充
+    CoverageScratch coverage_scratch;
+    bool use_raster_cache = true; // 参数不变时回放上次光栅化的结果
+    RasterCache raster_cache;
 
     // 主循环：处理窗口事件和渲染
     while (!glfwWindowShouldClose(window)) {
@@ -44,10 +81,63 @@ int main()
         ImDrawList* draw_list = ImGui::GetWindowDrawList(); // 获取绘图列表
         ImVec2 canvas_pos = ImGui::GetCursorScreenPos(); // 获取画布的位置
         ImU32 color = ImColor(polygonParams.color); // 获取多边形的颜色
+        const int n = polygonParams.vertexCount;
 
         ImVec2 canvas_size = ImGui::GetContentRegionAvail(); // 获取画布的大小
-        // 使用有序边表算法绘制填充多边形
-        DrawPolygonWithOrderedEdgeTable(draw_list, canvas_pos, polygonParams.x, polygonParams.y, polygonParams.vertexCount, color);
+        if (use_cpu_canvas && canvas_size.x >= 1.0f && canvas_size.y >= 1.0f) {
+            // 在 CPU 画布中光栅化，只显示一个纹理四边形
+            int old_width = pixel_canvas.buffer.width, old_height = pixel_canvas.buffer.height;
+            pixel_canvas.Resize((int)canvas_size.x, (int)canvas_size.y);
+            if (needs_redraw || old_width != pixel_canvas.buffer.width || old_height != pixel_canvas.buffer.height) {
+                pixel_canvas.Clear(0);
+                if (use_scene) {
+                    BuildHoleScene(scene, polygonParams, color, static_cast<FillRule>(fill_rule), reverse_hole);
+                    FillSceneScanline(pixel_canvas, scene);
+                }
+                else if (antialiased)
+                    FillPolygonCoverage(pixel_canvas, polygonParams.x.data(), polygonParams.y.data(), polygonParams.vertexCount, color, FILL_EVEN_ODD, coverage_scratch);
+                else
+                    DrawPolygonWithOrderedEdgeTable(pixel_canvas, polygonParams.x, polygonParams.y, polygonParams.vertexCount, color);
+                needs_redraw = false;
+            }
+            pixel_canvas.Show();
+        } else if (use_scene) {
+            // 场景由顶点、填充规则和内轮廓方向决定，命中缓存时连场景也不用重建
+            DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+            auto rasterize = [&](RasterTarget& out) {
+                BuildHoleScene(scene, polygonParams, color, static_cast<FillRule>(fill_rule), reverse_hole);
+                FillSceneScanline(out, scene);
+            };
+            if (use_raster_cache) {
+                std::vector<float> params(polygonParams.x.begin(), polygonParams.x.begin() + n);
+                params.insert(params.end(), polygonParams.y.begin(), polygonParams.y.begin() + n);
+                params.push_back(static_cast<float>(fill_rule));
+                params.push_back(reverse_hole ? 1.0f : 0.0f);
+                raster_cache.Draw(target, RASTER_SCENE, color, params.data(), params.size() * sizeof(float), rasterize);
+            } else {
+                rasterize(target);
+            }
+        } else if (antialiased) {
+            // 每个像素一个 1x1 的四边形，覆盖 [x, x + 1) x [y, y + 1)，边缘像素的 alpha 由 ImGui 混合
+            DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+            auto rasterize = [&](RasterTarget& out) {
+                FillPolygonCoverage(out, polygonParams.x.data(), polygonParams.y.data(), n, color, FILL_EVEN_ODD, coverage_scratch);
+            };
+            if (use_raster_cache)
+                raster_cache.DrawPolygon(target, RASTER_COVERAGE, color, polygonParams.x.data(), polygonParams.y.data(), n, rasterize);
+            else
+                rasterize(target);
+        } else {
+            // 使用有序边表算法绘制填充多边形
+            DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+            auto rasterize = [&](RasterTarget& out) {
+                DrawPolygonWithOrderedEdgeTable(out, polygonParams.x, polygonParams.y, n, color);
+            };
+            if (use_raster_cache)
+                raster_cache.DrawPolygon(target, RASTER_ORDERED_EDGE_TABLE, color, polygonParams.x.data(), polygonParams.y.data(), n, rasterize);
+            else
+                rasterize(target);
+        }
 
         ImGui::End(); // 结束绘制窗口
 
@@ -57,11 +147,11 @@ int main()
             ImGui::SetWindowSize(ImVec2(500, 500));
             // 多边形颜色调整
             ImGui::Text("Polygon Color:"); // 显示颜色标签
-            ImGui::ColorEdit3("Change Color", (float*)&polygonParams.color); // 编辑颜色
+            needs_redraw |= ImGui::ColorEdit3("Change Color", (float*)&polygonParams.color); // 编辑颜色
 
             // 顶点数调整
             ImGui::Text("Number of Vertices:"); // 显示顶点数标签
-            ImGui::SliderInt("##Vertex Count", &polygonParams.vertexCount, 3, 8); // 调整顶点数，最少3个，最多8个
+            needs_redraw |= ImGui::SliderInt("##Vertex Count", &polygonParams.vertexCount, 3, 8); // 调整顶点数，最少3个，最多8个
 
             // 调整每个顶点的坐标
             ImGui::Text("Polygon Vertex Coordinates:"); // 显示顶点坐标标签
@@ -71,14 +161,37 @@ int main()
                 ImGui::PushItemWidth(ImGui::GetContentRegionAvail().x * 0.5f);
                 // 设置第一个控件（x坐标）宽度为窗口的一半
                 // 调整 x 坐标
-                ImGui::SliderFloat(("x" + std::to_string(i)).c_str(), &polygonParams.x[i], 0.0f, canvas_size.x, "%0.1f");
+                needs_redraw |= ImGui::SliderFloat(("x" + std::to_string(i)).c_str(), &polygonParams.x[i], 0.0f, canvas_size.x, "%0.1f");
                 ImGui::SameLine(); // 同行显示 y 坐标的调整
                 // 调整 y 坐标
-                ImGui::SliderFloat(("y" + std::to_string(i)).c_str(), &polygonParams.y[i], 0.0f, canvas_size.y);
+                needs_redraw |= ImGui::SliderFloat(("y" + std::to_string(i)).c_str(), &polygonParams.y[i], 0.0f, canvas_size.y);
                 ImGui::PopItemWidth();
                 ImGui::PopID(); // 恢复控件 ID
             }
 
+            // 场景填充：外轮廓加一条内轮廓，比较两种填充规则
+            needs_redraw |= ImGui::Checkbox("Inner Contour (Scene Fill)", &use_scene);
+            if (use_scene) {
+                needs_redraw |= ImGui::RadioButton("Even-Odd", &fill_rule, FILL_EVEN_ODD);
+                ImGui::SameLine();
+                needs_redraw |= ImGui::RadioButton("Nonzero", &fill_rule, FILL_NONZERO);
+                needs_redraw |= ImGui::Checkbox("Reverse Inner Contour", &reverse_hole);
+            }
+
+            // 抗锯齿：按边累加每个像素的覆盖面积，不做超采样
+            if (!use_scene)
+                needs_redraw |= ImGui::Checkbox("Antialiased (Coverage Fill)", &antialiased);
+
+            // CPU 像素画布：每帧只上传改动过的区域
+            if (ImGui::Checkbox("CPU Pixel Canvas", &use_cpu_canvas))
+                needs_redraw = true;
+            if (use_cpu_canvas)
+                ImGui::Text("Uploaded this frame: %d bytes", pixel_canvas.uploaded_bytes);
+
+            // 光栅化结果缓存：参数不变的帧只回放记录的像素段
+            if (!use_cpu_canvas)
+                ImGui::Checkbox("Raster Cache", &use_raster_cache);
+
             // 确认按钮：按下后打印当前的顶点坐标
             if (ImGui::Button("Confirm")) {
                 for (int i = 0; i < polygonParams.vertexCount; ++i) {
@@ -88,9 +201,12 @@ int main()
             ImGui::End(); // 结束控制面板窗口
         }
 
+        if (use_raster_cache && !use_cpu_canvas)
+            ShowRasterCacheOverlay(raster_cache);
         EndImGuiFrame(window); // 结束当前帧并交换缓冲区，渲染结果
     }
 
+    pixel_canvas.Release(); // 在 OpenGL 上下文销毁前释放纹理
     CleanupGLFWAndImGui(window); // 清理资源，关闭窗口
     return 0;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Algorithm.h" // 导入算法相关头文件
+#include "RasterCache.h" // 光栅化结果缓存
 #include "easyimgui.h" // 导入自定义的 EasyImGui 库
 #include <cstdio>
 #include <imgui.h> // 导入 ImGui 库
@@ -33,6 +34,8 @@ int main()
     polygonParams.y = { 250.0f, 323.0f, 323.0f, 250.0f, 177.0f, 177.0f };
     
     bool show_control_window = true; // 控制面板是否显示
+    bool use_raster_cache = true; // 参数不变时回放上次光栅化的结果
+    RasterCache raster_cache;
 
     // 主循环：处理窗口事件和渲染
     while (!glfwWindowShouldClose(window)) {
@@ -46,8 +49,17 @@ int main()
         ImU32 color = ImColor(polygonParams.color); // 获取多边形的颜色
 
         ImVec2 canvas_size = ImGui::GetContentRegionAvail(); // 获取画布的大小
-        // 使用有序边表算法绘制填充多边形
-        DrawPolygonWithEdgeFlagMethod(draw_list, canvas_pos, polygonParams.x, polygonParams.y, polygonParams.vertexCount, color);
+        // 使用边标志法绘制填充多边形；顶点和颜色不变的帧直接回放缓存的像素段
+        auto rasterize = [&](RasterTarget& out) {
+            DrawPolygonWithEdgeFlagMethod(out, polygonParams.x, polygonParams.y, polygonParams.vertexCount, color);
+        };
+        {
+            DrawListTarget target(draw_list, ImVec2(canvas_pos.x + 0.5f, canvas_pos.y + 0.5f), 0.5f, PIXEL_QUAD);
+            if (use_raster_cache)
+                raster_cache.DrawPolygon(target, RASTER_EDGE_FLAG, color, polygonParams.x.data(), polygonParams.y.data(), polygonParams.vertexCount, rasterize);
+            else
+                rasterize(target);
+        }
 
         ImGui::End(); // 结束绘制窗口
 
@@ -79,6 +91,9 @@ int main()
                 ImGui::PopID(); // 恢复控件 ID
             }
 
+            // 光栅化结果缓存
+            ImGui::Checkbox("Raster Cache", &use_raster_cache);
+
             // 确认按钮：按下后打印当前的顶点坐标
             if (ImGui::Button("Confirm")) {
                 for (int i = 0; i < polygonParams.vertexCount; ++i) {
@@ -88,6 +103,8 @@ int main()
             ImGui::End(); // 结束控制面板窗口
         }
 
+        if (use_raster_cache)
+            ShowRasterCacheOverlay(raster_cache);
         EndImGuiFrame(window); // 结束当前帧并交换缓冲区，渲染结果
     }
 
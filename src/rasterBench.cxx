@@ -0,0 +1,1917 @@
+// 光栅化算法性能测试（无需窗口，直接在命令行运行）
+#include "Algorithm.h"
+#include "ConicOffsetCache.h"
+#include "CoverageFill.h"
+#include "EdgeFlagFill.h"
+#include "FrustumClip.h"
+#include "LineBatch.h"
+#include "LineClip.h"
+#include "PolygonClip.h"
+#include "PolygonIndex.h"
+#include "RasterCache.h"
+#include "ScanlineFill.h"
+#include "SeedFill.h"
+#include "ThreadPool.h"
+#include "TileRaster.h"
+#include "Triangulate.h"
+#include <imgui.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+// 重复执行若干次，返回单次平均耗时（毫秒）
+template <typename Fn>
+double MeasureMs(int iterations, Fn&& fn)
+{
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        fn();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - begin).count() / iterations;
+}
+
+// 初始化一个不需要窗口的 ImGui 上下文，只用来提供 ImDrawList 的共享数据
+static void InitHeadlessImGui()
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(4096.0f, 4096.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+
+    unsigned char* pixels = nullptr;
+    int width = 0, height = 0;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    ImGui::NewFrame();
+}
+
+// 每次测试前重置绘制列表，相当于新的一帧
+static void ResetDrawList(ImDrawList& draw_list)
+{
+    draw_list._ResetForNewFrame();
+    draw_list.PushClipRectFullScreen();
+    draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+// exp2 - exp4：逐像素画圆与批量四边形的顶点数、耗时对比
+static void BenchLineEmission()
+{
+    typedef void (*LineFunc)(ImDrawList*, ImVec2, ImVec2, ImU32, float, PixelStyle);
+    struct Case {
+        const char* name;
+        LineFunc func;
+    };
+    const Case cases[] = {
+        { "DDA", DrawLineDDA },
+        { "Midpoint", DrawLineMidpoint },
+        { "Bresenham", DrawLineBresenham },
+    };
+
+    // 一条约 2000 像素长的直线
+    const ImVec2 start(10.0f, 10.0f);
+    const ImVec2 end(2010.0f, 710.0f);
+    const ImU32 color = IM_COL32(0, 0, 255, 255);
+    const float radius = 2.0f;
+    const int iterations = 50;
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+
+    printf("== Line emission (2000 px line, radius %.1f) ==\n", radius);
+    printf("%-10s %-8s %10s %12s\n", "algorithm", "style", "vertices", "ms/frame");
+    for (const Case& c : cases) {
+        for (int s = 0; s < 2; ++s) {
+            PixelStyle style = s == 0 ? PIXEL_CIRCLE : PIXEL_QUAD;
+            ResetDrawList(draw_list);
+            c.func(&draw_list, start, end, color, radius, style);
+            int vertices = draw_list.VtxBuffer.Size;
+
+            double ms = MeasureMs(iterations, [&]() {
+                ResetDrawList(draw_list);
+                c.func(&draw_list, start, end, color, radius, style);
+            });
+            printf("%-10s %-8s %10d %12.4f\n", c.name, s == 0 ? "circle" : "quad", vertices, ms);
+        }
+    }
+    printf("\n");
+}
+
+// 直接光栅化到 CPU 帧缓冲的原始吞吐量（不经过 ImDrawList）
+static void BenchCpuRaster()
+{
+    const int size = 2048;
+    PixelBuffer buffer(size, size);
+    const ImU32 color = IM_COL32(255, 0, 0, 255);
+
+    // 随机线段
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(0.0f, size - 1.0f);
+    const int lineCount = 20000;
+    std::vector<ImVec2> starts(lineCount), ends(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        starts[i] = ImVec2(coord(rng), coord(rng));
+        ends[i] = ImVec2(coord(rng), coord(rng));
+    }
+
+    printf("== CPU RasterTarget (%dx%d RGBA8) ==\n", size, size);
+    printf("%-24s %14s\n", "primitive", "per second");
+
+    double ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineDDA(buffer, starts[i], ends[i], color);
+    });
+    printf("%-24s %14.0f\n", "DrawLineDDA", lineCount / ms * 1000.0);
+
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineMidpoint(buffer, starts[i], ends[i], color);
+    });
+    printf("%-24s %14.0f\n", "DrawLineMidpoint", lineCount / ms * 1000.0);
+
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(buffer, starts[i], ends[i], color);
+    });
+    printf("%-24s %14.0f\n", "DrawLineBresenham", lineCount / ms * 1000.0);
+
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < 2000; ++i)
+            DrawCircleMidpoint(buffer, ImVec2(1024.0f, 1024.0f), 100 + i % 800, color);
+    });
+    printf("%-24s %14.0f\n", "DrawCircleMidpoint", 2000 / ms * 1000.0);
+
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < 2000; ++i)
+            DrawEllipseMidpoint(buffer, ImVec2(1024.0f, 1024.0f), 100 + i % 800, 50 + i % 400, color);
+    });
+    printf("%-24s %14.0f\n", "DrawEllipseMidpoint", 2000 / ms * 1000.0);
+
+    // exp7 的默认六边形，放大到整个缓冲区
+    std::vector<float> px = { 1576.0f, 1288.0f, 712.0f, 424.0f, 712.0f, 1288.0f };
+    std::vector<float> py = { 1000.0f, 1292.0f, 1292.0f, 1000.0f, 708.0f, 708.0f };
+    ms = MeasureMs(50, [&]() {
+        DrawPolygonWithOrderedEdgeTable(buffer, px, py, 6, color);
+    });
+    printf("%-24s %14.0f\n", "OrderedEdgeTable fill", 1000.0 / ms);
+
+    ms = MeasureMs(50, [&]() {
+        DrawPolygonWithEdgeFlagMethod(buffer, px, py, 6, color);
+    });
+    printf("%-24s %14.0f\n", "EdgeFlagMethod fill", 1000.0 / ms);
+    printf("\n");
+}
+
+// 批量 DDA 与逐条 DrawLineDDA 的对比，指标为每秒线段数
+static void BenchLineBatch()
+{
+    const int size = 2048;
+    PixelBuffer buffer(size, size);
+    PixelBuffer reference(size, size);
+    const ImU32 color = IM_COL32(0, 255, 0, 255);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> coord(0.0f, size - 1.0f);
+    std::uniform_real_distribution<float> offset(-40.0f, 40.0f);
+
+    // 线框数据集：大量短线段
+    const int lineCount = 200000;
+    LineSegmentsSoA lines;
+    lines.Reserve(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        ImVec2 a(coord(rng), coord(rng));
+        lines.Add(a, ImVec2(a.x + offset(rng), a.y + offset(rng)));
+    }
+
+    printf("== Batch DDA (%d segments, kernel %s) ==\n", lineCount, LineBatchKernelName());
+    printf("%-24s %14s\n", "path", "lines/s");
+
+    double ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineDDA(reference, ImVec2(lines.x0[i], lines.y0[i]), ImVec2(lines.x1[i], lines.y1[i]), color);
+    });
+    printf("%-24s %14.0f\n", "DrawLineDDA x N", lineCount / ms * 1000.0);
+
+    ms = MeasureMs(3, [&]() { DrawLinesDDA(buffer, lines, color); });
+    printf("%-24s %14.0f\n", "DrawLinesDDA -> target", lineCount / ms * 1000.0);
+
+    std::vector<PixelCoord> pixels;
+    pixels.reserve(lineCount * 48);
+    ms = MeasureMs(3, [&]() {
+        pixels.clear();
+        DrawLinesDDA(pixels, lines);
+    });
+    printf("%-24s %14.0f\n", "DrawLinesDDA -> pixels", lineCount / ms * 1000.0);
+    printf("identical to scalar: %s\n", buffer.pixels == reference.pixels ? "yes" : "NO");
+
+    // 端点在 +-1e6 处、穿过画布的长线：每条线段装入时裁剪，只走可见的那几千步
+    const int farCount = 2000;
+    std::uniform_real_distribution<float> far(-1.0e6f, 1.0e6f);
+    LineSegmentsSoA farLines;
+    farLines.Reserve(farCount);
+    for (int i = 0; i < farCount; ++i) {
+        ImVec2 a(coord(rng), coord(rng));
+        ImVec2 d(far(rng), far(rng));
+        farLines.Add(ImVec2(a.x - d.x, a.y - d.y), ImVec2(a.x + d.x, a.y + d.y));
+    }
+    buffer.Clear(0);
+    reference.Clear(0);
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < farCount; ++i)
+            DrawLineDDA(reference, ImVec2(farLines.x0[i], farLines.y0[i]), ImVec2(farLines.x1[i], farLines.y1[i]), color);
+    });
+    printf("%-24s %14.0f\n", "off-canvas DrawLineDDA", farCount / ms * 1000.0);
+    ms = MeasureMs(3, [&]() { DrawLinesDDA(buffer, farLines, color); });
+    printf("%-24s %14.0f\n", "off-canvas DrawLinesDDA", farCount / ms * 1000.0);
+    printf("identical to scalar: %s\n\n", buffer.pixels == reference.pixels ? "yes" : "NO");
+}
+
+// 逐像素与按游程输出的对比（接近水平的直线游程很长）
+static void BenchRunSlice()
+{
+    const int size = 2048;
+    PixelBuffer perPixel(size, size);
+    PixelBuffer runSlice(size, size);
+    const ImU32 color = IM_COL32(255, 255, 0, 255);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coord(0.0f, size - 1.0f);
+    std::uniform_real_distribution<float> slope(-0.1f, 0.1f);
+    const int lineCount = 20000;
+    std::vector<ImVec2> starts(lineCount), ends(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        float x0 = coord(rng) * 0.25f, y0 = coord(rng);
+        float x1 = x0 + coord(rng) * 0.75f;
+        starts[i] = ImVec2(x0, y0);
+        ends[i] = ImVec2(x1, std::min(size - 1.0f, std::max(0.0f, y0 + (x1 - x0) * slope(rng))));
+    }
+
+    printf("== Run-slice lines (%d near-horizontal lines) ==\n", lineCount);
+    printf("%-28s %12s %14s\n", "path", "buffer ms", "quad vertices");
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    auto countVertices = [&](bool runs) {
+        ResetDrawList(draw_list);
+        for (int i = 0; i < lineCount; ++i) {
+            if (runs)
+                DrawLineBresenhamRunSlice(&draw_list, starts[i], ends[i], color, 0.5f, PIXEL_QUAD);
+            else
+                DrawLineBresenham(&draw_list, starts[i], ends[i], color, 0.5f, PIXEL_QUAD);
+        }
+        return draw_list.VtxBuffer.Size;
+    };
+
+    double ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(perPixel, starts[i], ends[i], color);
+    });
+    printf("%-28s %12.3f %14d\n", "DrawLineBresenham", ms, countVertices(false));
+
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenhamRunSlice(runSlice, starts[i], ends[i], color);
+    });
+    printf("%-28s %12.3f %14d\n", "DrawLineBresenhamRunSlice", ms, countVertices(true));
+    printf("identical pixels: %s\n\n", perPixel.pixels == runSlice.pixels ? "yes" : "NO");
+}
+
+// 把像素转发给另一个目标；类型不是 PixelBuffer，所以只能走通用的虚函数路径
+struct ForwardingTarget : RasterTarget {
+    RasterTarget& inner;
+
+    explicit ForwardingTarget(RasterTarget& inner)
+        : inner(inner)
+    {
+    }
+
+    void Plot(int x, int y, ImU32 color) override { inner.Plot(x, y, color); }
+};
+
+// 特化之前的实现：主方向和步进方向在内层循环中运行时判断
+static void DrawLineRuntimeOctant(RasterTarget& target, ImVec2 start, ImVec2 end, ImU32 color)
+{
+    int x0 = static_cast<int>(start.x), y0 = static_cast<int>(start.y);
+    int x1 = static_cast<int>(end.x), y1 = static_cast<int>(end.y);
+    int dx = std::abs(x1 - x0), dy = std::abs(y1 - y0);
+    int x_step = (x1 > x0) ? 1 : -1;
+    int y_step = (y1 > y0) ? 1 : -1;
+    bool is_steep = dy > dx;
+    if (is_steep)
+        std::swap(dx, dy);
+
+    int d = 2 * dy - dx, incE = 2 * dy, incNE = 2 * (dy - dx);
+    int x = x0, y = y0;
+    target.Plot(x, y, color);
+    for (int i = 0; i < dx; ++i) {
+        if (d > 0) {
+            if (is_steep)
+                x += x_step;
+            else
+                y += y_step;
+            d += incNE;
+        } else {
+            d += incE;
+        }
+        if (is_steep)
+            y += y_step;
+        else
+            x += x_step;
+        target.Plot(x, y, color);
+    }
+}
+
+// 按八分象限特化的直线内核，在不同输出目标上与运行时分支版本对比
+static void BenchOctantLines()
+{
+    const int size = 2048;
+    const ImU32 color = IM_COL32(0, 255, 255, 255);
+    PixelBuffer reference(size, size);
+    PixelBuffer forwarded(size, size);
+    PixelBuffer direct(size, size);
+
+    // 各个方向的随机直线，全部在缓冲区内
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<float> coord(0.0f, size - 1.0f);
+    const int lineCount = 20000;
+    std::vector<ImVec2> starts(lineCount), ends(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        starts[i] = ImVec2(coord(rng), coord(rng));
+        ends[i] = ImVec2(coord(rng), coord(rng));
+    }
+
+    printf("== Octant-specialized lines (%d random lines) ==\n", lineCount);
+    printf("%-36s %12s\n", "path", "ms");
+
+    double baseline = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineRuntimeOctant(reference, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f\n", "runtime branches, virtual Plot", baseline);
+
+    ForwardingTarget forward(forwarded);
+    double ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(forward, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f  (%.2fx)\n", "specialized, virtual Plot", ms, baseline / ms);
+
+    ms = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(direct, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f  (%.2fx)\n", "specialized, PixelBuffer direct", ms, baseline / ms);
+
+    std::vector<PixelCoord> collected;
+    ms = MeasureMs(3, [&]() {
+        collected.clear();
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(collected, starts[i], ends[i]);
+    });
+    printf("%-36s %12.3f  (%.2fx)\n", "specialized, pixel collector", ms, baseline / ms);
+
+    // 绘制列表每个像素 4 个顶点，只取前 1000 条线
+    const int drawListLines = 1000;
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    double targetMs = MeasureMs(3, [&]() {
+        ResetDrawList(draw_list);
+        DrawListTarget target(&draw_list, ImVec2(0.0f, 0.0f), 0.5f, PIXEL_QUAD);
+        for (int i = 0; i < drawListLines; ++i)
+            DrawLineRuntimeOctant(target, starts[i], ends[i], color);
+    });
+    int targetVertices = draw_list.VtxBuffer.Size;
+    printf("%-36s %12.3f\n", "runtime branches, DrawListTarget quad", targetMs);
+
+    ms = MeasureMs(3, [&]() {
+        ResetDrawList(draw_list);
+        for (int i = 0; i < drawListLines; ++i)
+            DrawLineBresenham(&draw_list, starts[i], ends[i], color, 0.5f, PIXEL_QUAD);
+    });
+    printf("%-36s %12.3f  (%.2fx)\n", "specialized, ImDrawList quad", ms, targetMs / ms);
+
+    bool identical = reference.pixels == forwarded.pixels && reference.pixels == direct.pixels
+        && targetVertices == draw_list.VtxBuffer.Size;
+    PixelBuffer replayed(size, size);
+    for (const PixelCoord& p : collected)
+        replayed.Plot(p.x, p.y, color);
+    identical = identical && replayed.pixels == reference.pixels;
+    printf("identical pixels: %s\n\n", identical ? "yes" : "NO");
+}
+
+// 端点远在画布外的直线：先裁剪再把决策变量跳到第一个可见像素
+static void BenchClippedLines()
+{
+    const int width = 1280, height = 720;
+    const ImU32 color = IM_COL32(255, 0, 255, 255);
+    PixelBuffer unclipped(width, height);
+    PixelBuffer clipped(width, height);
+
+    // 端点在 ±1e6 处，直线穿过画布
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<float> inside(0.0f, height - 1.0f);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    const int lineCount = 200;
+    std::vector<ImVec2> starts(lineCount), ends(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        ImVec2 center(inside(rng), inside(rng));
+        float a = angle(rng);
+        ImVec2 dir(std::cos(a) * 1.0e6f, std::sin(a) * 1.0e6f);
+        starts[i] = center - dir;
+        ends[i] = center + dir;
+    }
+
+    printf("== Clipped lines (%d lines, endpoints at +-1e6) ==\n", lineCount);
+    printf("%-36s %12s\n", "path", "ms");
+
+    ForwardingTarget forward(unclipped);
+    double baseline = MeasureMs(1, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(forward, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f\n", "no clip rect (every step)", baseline);
+
+    double ms = MeasureMs(10, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineBresenham(clipped, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f  (%.0fx)\n", "clipped PixelBuffer", ms, baseline / ms);
+    printf("identical pixels: %s\n", unclipped.pixels == clipped.pixels ? "yes" : "NO");
+
+    // 浮点 DDA 不能精确跳步，从第一个可见步直接算起点，所以只比较耗时
+    baseline = MeasureMs(1, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineDDA(forward, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f\n", "DDA, no clip rect (every step)", baseline);
+    ms = MeasureMs(10, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineDDA(clipped, starts[i], ends[i], color);
+    });
+    printf("%-36s %12.3f  (%.0fx)\n\n", "DDA, clipped PixelBuffer", ms, baseline / ms);
+}
+
+// 记录最后一个像素，用来检查终点是否命中
+struct LastPixelTarget : RasterTarget {
+    int x = 0, y = 0;
+
+    void Plot(int px, int py, ImU32 /*color*/) override
+    {
+        x = px;
+        y = py;
+    }
+};
+
+// 浮点 DDA 与 32.32 定点 DDA：终点误差和速度
+static void BenchFixedDDA()
+{
+    const int size = 2048;
+    const ImU32 color = IM_COL32(255, 128, 0, 255);
+    PixelBuffer floatBuffer(size, size);
+    PixelBuffer fixedBuffer(size, size);
+
+    std::mt19937 rng(41);
+    std::uniform_real_distribution<float> coord(0.0f, size - 1.0f);
+    const int lineCount = 20000;
+    std::vector<ImVec2> starts(lineCount), ends(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        starts[i] = ImVec2(std::floor(coord(rng)), std::floor(coord(rng)));
+        ends[i] = ImVec2(std::floor(coord(rng)), std::floor(coord(rng)));
+    }
+
+    // 远离原点的长线：float 的精度随坐标增大而下降
+    std::uniform_real_distribution<float> far(1.0e6f, 2.0e6f);
+    const int farCount = 200;
+    int floatMisses = 0, fixedMisses = 0;
+    for (int i = 0; i < farCount; ++i) {
+        ImVec2 a(std::floor(far(rng)), std::floor(far(rng)));
+        ImVec2 b(std::floor(far(rng)), std::floor(far(rng)));
+        LastPixelTarget last;
+        DrawLineDDA(last, a, b, color);
+        floatMisses += (last.x != static_cast<int>(b.x) || last.y != static_cast<int>(b.y)) ? 1 : 0;
+        DrawLineDDAFixed(last, a, b, color);
+        fixedMisses += (last.x != static_cast<int>(b.x) || last.y != static_cast<int>(b.y)) ? 1 : 0;
+    }
+
+    printf("== Fixed-point DDA (%d random lines) ==\n", lineCount);
+    printf("%-28s %12s %18s\n", "path", "ms", "endpoint misses");
+    double floatMs = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineDDA(floatBuffer, starts[i], ends[i], color);
+    });
+    printf("%-28s %12.3f %14d/%d\n", "DrawLineDDA (float)", floatMs, floatMisses, farCount);
+    double fixedMs = MeasureMs(3, [&]() {
+        for (int i = 0; i < lineCount; ++i)
+            DrawLineDDAFixed(fixedBuffer, starts[i], ends[i], color);
+    });
+    printf("%-28s %12.3f %14d/%d\n", "DrawLineDDAFixed (32.32)", fixedMs, fixedMisses, farCount);
+
+    size_t differing = 0;
+    for (size_t i = 0; i < floatBuffer.pixels.size(); ++i)
+        differing += floatBuffer.pixels[i] != fixedBuffer.pixels[i] ? 1 : 0;
+    printf("pixels differing from float DDA: %zu\n\n", differing);
+}
+
+// 实心圆/椭圆：每行一段与逐像素绘制的对比
+static void BenchFilledConics()
+{
+    const int size = 1100;
+    const int radius = 500;
+    const ImVec2 center(size * 0.5f, size * 0.5f);
+    const ImU32 color = IM_COL32(0, 200, 100, 255);
+    PixelBuffer perPixel(size, size);
+    PixelBuffer spans(size, size);
+
+    printf("== Filled circle (radius %d) ==\n", radius);
+    printf("%-28s %12s %14s\n", "path", "buffer ms", "quad vertices");
+
+    // 逐像素：不重载 PlotSpan，每段按默认实现拆成逐个 Plot
+    struct PixelCounter : RasterTarget {
+        PixelBuffer& inner;
+        int plotted = 0;
+        explicit PixelCounter(PixelBuffer& inner)
+            : inner(inner)
+        {
+        }
+        void Plot(int x, int y, ImU32 c) override
+        {
+            inner.Plot(x, y, c);
+            plotted++;
+        }
+    } pixelwise(perPixel);
+    double pixelMs = MeasureMs(10, [&]() {
+        pixelwise.plotted = 0;
+        DrawCircleFilledMidpoint(pixelwise, center, radius, color);
+    });
+    printf("%-28s %12.3f %14d\n", "per-pixel Plot", pixelMs, pixelwise.plotted * 4);
+
+    double spanMs = MeasureMs(10, [&]() {
+        DrawCircleFilledMidpoint(spans, center, radius, color);
+    });
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ResetDrawList(draw_list);
+    DrawCircleFilledMidpoint(&draw_list, center, radius, color);
+    printf("%-28s %12.3f %14d\n", "DrawCircleFilledMidpoint", spanMs, draw_list.VtxBuffer.Size);
+    printf("identical pixels: %s\n", perPixel.pixels == spans.pixels ? "yes" : "NO");
+
+    double ellipseMs = MeasureMs(10, [&]() {
+        DrawEllipseFilledMidpoint(spans, center, radius, radius / 2, color);
+    });
+    ResetDrawList(draw_list);
+    DrawEllipseFilledMidpoint(&draw_list, center, radius, radius / 2, color);
+    printf("%-28s %12.3f %14d\n\n", "DrawEllipseFilledMidpoint", ellipseMs, draw_list.VtxBuffer.Size);
+}
+
+// exp5 / exp6：每帧重绘同样大小的圆和椭圆，偏移表缓存与重新计算的对比
+static void BenchOffsetCache()
+{
+    const int size = 1024;
+    const int frames = 2000;
+    const ImU32 color = IM_COL32(0, 0, 255, 255);
+    PixelBuffer walked(size, size);
+    PixelBuffer cached(size, size);
+    ConicOffsetCache cache(32);
+
+    printf("== Offset cache (%d frames, circle r=300 + ellipse 300x150) ==\n", frames);
+    printf("%-28s %12s\n", "path", "ms/frame");
+
+    const ImVec2 center(size * 0.5f, size * 0.5f);
+    double walkMs = MeasureMs(frames, [&]() {
+        DrawCircleMidpoint(walked, center, 300, color);
+        DrawEllipseMidpoint(walked, center, 300, 150, color);
+    });
+    printf("%-28s %12.4f\n", "midpoint walk", walkMs);
+
+    double cachedMs = MeasureMs(frames, [&]() {
+        DrawCircleMidpointCached(cached, center, 300, color, cache);
+        DrawEllipseMidpointCached(cached, center, 300, 150, color, cache);
+    });
+    printf("%-28s %12.4f  (%.2fx)\n", "cached offsets", cachedMs, walkMs / cachedMs);
+    printf("hits %zu, misses %zu, %zu entries, %zu bytes\n", cache.hits, cache.misses, cache.EntryCount(), cache.MemoryBytes());
+    printf("identical pixels: %s\n\n", walked.pixels == cached.pixels ? "yes" : "NO");
+}
+
+// 原来的有序边表实现：每次调用重新分配边表，每条扫描线完整排序一次 AET
+static void FillPolygonSortPerScanline(RasterTarget& target,
+    const std::vector<float>& x,
+    const std::vector<float>& y,
+    int vertexCount,
+    ImU32 color)
+{
+    if (vertexCount < 3)
+        return; // 至少需要 3 个顶点
+
+    // 首先找到多边形的y范围
+    int ymin = std::numeric_limits<int>::max();
+    int ymax = std::numeric_limits<int>::min();
+
+    for (int i = 0; i < vertexCount; ++i) {
+        ymin = std::min(ymin, static_cast<int>(std::floor(y[i])));
+        ymax = std::max(ymax, static_cast<int>(std::ceil(y[i])));
+    }
+
+    // 创建边表，根据y范围动态调整大小
+    const int rowCount = ymax - ymin + 1;
+    std::vector<std::vector<Edge>> edgeTable(rowCount);
+
+    for (int i = 0; i < vertexCount; ++i) {
+        int next = (i + 1) % vertexCount;
+        float x0f = x[i];
+        float y0f = y[i];
+        float x1f = x[next];
+        float y1f = y[next];
+
+        // 忽略水平边
+        if (y0f == y1f)
+            continue;
+
+        // 确保 y0 < y1
+        if (y0f > y1f) {
+            std::swap(x0f, x1f);
+            std::swap(y0f, y1f);
+        }
+
+        // 计算边的增量
+        float dx = (x1f - x0f) / (y1f - y0f);
+
+        // 根据扫描线规则处理顶点共享情况
+        // 如果顶点是局部最小或最大，只包含一次
+        if (std::ceil(y0f) == std::floor(y1f)) {
+            y1f -= 1.0f; // 让上端点不包含在当前边
+        }
+        // Edge(float x_val, float dx_val, int ymax_val): x(x_val), dx(dx_val),
+        // ymax(ymax_val) {}
+        Edge edge;
+        edge.x = x0f;
+        edge.dx = dx;
+        edge.ymax = static_cast<int>(std::ceil(y1f));
+
+        // 将边添加到对应的边表
+        int edgeTableIndex = static_cast<int>(std::floor(y0f)) - ymin;
+        if (edgeTableIndex >= 0 && edgeTableIndex < rowCount) {
+            edgeTable[edgeTableIndex].push_back(edge);
+        }
+    }
+
+    // 初始化活动边表 (Active Edge Table, AET)
+    std::vector<Edge> activeEdgeTable;
+
+    // 扫描线填充
+    for (int y = ymin; y <= ymax; ++y) {
+        int scanLine = y;
+
+        // 将当前扫描线的边加入 AET
+        if (scanLine - ymin >= 0 && scanLine - ymin < rowCount) {
+            activeEdgeTable.insert(activeEdgeTable.end(),
+                edgeTable[scanLine - ymin].begin(),
+                edgeTable[scanLine - ymin].end());
+        }
+
+        // 移除 y >= ymax 的边
+        activeEdgeTable.erase(
+            std::remove_if(activeEdgeTable.begin(),
+                activeEdgeTable.end(),
+                [scanLine](const Edge& e) { return e.ymax <= scanLine; }),
+            activeEdgeTable.end());
+
+        // 按 x 排序 AET
+        std::sort(activeEdgeTable.begin(),
+            activeEdgeTable.end(),
+            [](const Edge& a, const Edge& b) -> bool { return a.x < b.x; });
+
+        // 使用偶数奇数规则绘制扫描线
+        for (size_t i = 0; i + 1 < activeEdgeTable.size(); i += 2) {
+            float xStart = activeEdgeTable[i].x;
+            float xEnd = activeEdgeTable[i + 1].x;
+
+            // 转换为整数像素坐标
+            int pixelStart = static_cast<int>(std::ceil(xStart));
+            int pixelEnd = static_cast<int>(std::floor(xEnd));
+
+            if (pixelEnd >= pixelStart) {
+                target.PlotSpan(pixelStart, pixelEnd, scanLine, color);
+            }
+        }
+
+        // 更新 AET 中每条边的 x
+        for (auto& edge : activeEdgeTable) {
+            edge.x += edge.dx;
+        }
+    }
+}
+
+// 记录输出的所有水平段，用于逐段比较两种实现
+struct SpanRecorder : RasterTarget {
+    struct Span {
+        int x0, x1, y;
+        bool operator==(const Span& o) const { return x0 == o.x0 && x1 == o.x1 && y == o.y; }
+    };
+    std::vector<Span> spans;
+
+    void Plot(int x, int y, ImU32 color) override { PlotSpan(x, x, y, color); }
+    void PlotSpan(int x0, int x1, int y, ImU32 /*color*/) override { spans.push_back(Span { x0, x1, y }); }
+};
+
+// 半径带随机抖动的星形多边形，顶点数从 1k 到 1M
+static void MakeStarPolygon(int vertexCount, float cx, float cy, std::vector<float>& x, std::vector<float>& y, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> jitter(-20.0f, 20.0f);
+    x.resize(vertexCount);
+    y.resize(vertexCount);
+    for (int i = 0; i < vertexCount; ++i) {
+        float angle = 6.2831853f * i / vertexCount;
+        float r = 700.0f + 200.0f * std::sin(angle * 7.0f) + jitter(rng);
+        x[i] = cx + r * std::cos(angle);
+        y[i] = cy + r * std::sin(angle);
+    }
+}
+
+// CSR 边表 + 增量 AET 与原实现的对比
+static void BenchEdgeTable()
+{
+    const int size = 2048;
+    PixelBuffer buffer(size, size);
+    const ImU32 color = IM_COL32(0, 128, 255, 255);
+
+    printf("== Ordered edge table fill (2048x2048) ==\n");
+    printf("%-10s %14s %14s %10s %10s\n", "vertices", "sort/line ms", "CSR+AET ms", "speedup", "identical");
+
+    const int counts[] = { 1000, 10000, 100000, 1000000 };
+    for (int count : counts) {
+        std::vector<float> x, y;
+        MakeStarPolygon(count, size * 0.5f, size * 0.5f, x, y, static_cast<unsigned>(count));
+        int iterations = std::max(1, 100000 / count);
+
+        double oldMs = MeasureMs(iterations, [&]() { FillPolygonSortPerScanline(buffer, x, y, count, color); });
+        double newMs = MeasureMs(iterations, [&]() { DrawPolygonWithOrderedEdgeTable(buffer, x, y, count, color); });
+
+        SpanRecorder before, after;
+        FillPolygonSortPerScanline(before, x, y, count, color);
+        DrawPolygonWithOrderedEdgeTable(after, x, y, count, color);
+        printf("%-10d %14.3f %14.3f %9.2fx %10s\n", count, oldMs, newMs, oldMs / newMs, before.spans == after.spans ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// 地图式场景：grid x grid 个共享顶点的抖动四边形，相邻区域共边，区域之间没有缝隙也没有重叠
+static void MakeMapScene(int grid, int size, FillScene& scene)
+{
+    std::mt19937 rng(7);
+    const float cell = static_cast<float>(size) / grid;
+    std::uniform_real_distribution<float> jitter(-0.3f * cell, 0.3f * cell);
+    std::vector<float> gridX((grid + 1) * (grid + 1)), gridY((grid + 1) * (grid + 1));
+    for (int gy = 0; gy <= grid; ++gy) {
+        for (int gx = 0; gx <= grid; ++gx) {
+            bool border = gx == 0 || gy == 0 || gx == grid || gy == grid;
+            gridX[gy * (grid + 1) + gx] = gx * cell + (border ? 0.0f : jitter(rng));
+            gridY[gy * (grid + 1) + gx] = gy * cell + (border ? 0.0f : jitter(rng));
+        }
+    }
+
+    scene.Clear();
+    for (int gy = 0; gy < grid; ++gy) {
+        for (int gx = 0; gx < grid; ++gx) {
+            const int corners[4] = { gy * (grid + 1) + gx, gy * (grid + 1) + gx + 1, (gy + 1) * (grid + 1) + gx + 1, (gy + 1) * (grid + 1) + gx };
+            float x[4], y[4];
+            for (int k = 0; k < 4; ++k) {
+                x[k] = gridX[corners[k]];
+                y[k] = gridY[corners[k]];
+            }
+            scene.AddContour(scene.AddFill(IM_COL32(rng() & 255, rng() & 255, rng() & 255, 255)), x, y, 4);
+        }
+    }
+}
+
+// 10k 个地图区域：整个场景扫描一遍与逐个填充的结果相同，这里同时记录两者的耗时
+// 区域互不重叠时场景扫描没有优势（每行的 AET 有全部区域的边），它的用处是多轮廓、带洞和重叠次序
+static void BenchSceneFill()
+{
+    const int size = 2048;
+    const int grid = 100;
+    PixelBuffer buffer(size, size);
+
+    FillScene scene;
+    MakeMapScene(grid, size, scene);
+    std::vector<std::vector<float>> xs, ys;
+    for (int c = 0; c < scene.ContourCount(); ++c) {
+        xs.emplace_back(scene.x.begin() + scene.contour_start[c], scene.x.begin() + scene.contour_start[c + 1]);
+        ys.emplace_back(scene.y.begin() + scene.contour_start[c], scene.y.begin() + scene.contour_start[c + 1]);
+    }
+
+    printf("== Scene fill (%d polygons, 2048x2048) ==\n", grid * grid);
+    double separateMs = MeasureMs(10, [&]() {
+        for (size_t i = 0; i < xs.size(); ++i)
+            DrawPolygonWithOrderedEdgeTable(buffer, xs[i], ys[i], 4, scene.fills[i].color);
+    });
+    std::vector<ImU32> expected = buffer.pixels;
+
+    ScanlineScratch scratch;
+    double sceneMs = MeasureMs(10, [&]() { FillSceneScanline(buffer, scene, scratch); });
+    printf("%-24s %10.3f ms\n", "separate sweeps", separateMs);
+    printf("%-24s %10.3f ms\n", "one scene sweep", sceneMs);
+    printf("%-24s %10s\n", "identical pixels", expected == buffer.pixels ? "yes" : "NO");
+
+    // 只有一条轮廓时与 DrawPolygonWithOrderedEdgeTable 逐段相同
+    std::vector<float> x, y;
+    MakeStarPolygon(10000, size * 0.5f, size * 0.5f, x, y, 1);
+    FillScene single;
+    single.AddContour(single.AddFill(IM_COL32_WHITE), x.data(), y.data(), 10000);
+    SpanRecorder polygonSpans, sceneSpans;
+    DrawPolygonWithOrderedEdgeTable(polygonSpans, x, y, 10000, IM_COL32_WHITE);
+    FillSceneScanline(sceneSpans, single, scratch);
+    printf("%-24s %10s\n", "single contour spans", polygonSpans.spans == sceneSpans.spans ? "yes" : "NO");
+    printf("\n");
+}
+
+// 按行分带并行填充：1024x16384 的高画布，线程数从 1 到硬件线程数
+static void BenchParallelFill()
+{
+    const int width = 1024;
+    const int height = 16384;
+    PixelBuffer serial(width, height);
+    PixelBuffer parallel(width, height);
+    const ImU32 color = IM_COL32(255, 128, 0, 255);
+    const int hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    printf("== Band-parallel ordered edge table fill (%dx%d, %d hardware threads) ==\n", width, height, hardware);
+    printf("%-10s %8s %12s %10s %10s\n", "vertices", "threads", "ms", "speedup", "identical");
+
+    const int counts[] = { 10000, 1000000 };
+    for (int count : counts) {
+        // 星形在竖直方向拉伸到整个画布
+        std::vector<float> x, y;
+        MakeStarPolygon(count, 0.0f, 0.0f, x, y, static_cast<unsigned>(count));
+        for (int i = 0; i < count; ++i) {
+            x[i] = width * 0.5f + x[i] * 0.5f;
+            y[i] = height * 0.5f + y[i] * 8.0f;
+        }
+        int iterations = count > 100000 ? 3 : 20;
+
+        serial.Clear(0);
+        double serialMs = MeasureMs(iterations, [&]() { DrawPolygonWithOrderedEdgeTable(serial, x, y, count, color); });
+        printf("%-10d %8s %12.3f %10s %10s\n", count, "serial", serialMs, "1.00x", "-");
+
+        for (int threads = 1; threads <= hardware; threads *= 2) {
+            ThreadPool pool(threads);
+            parallel.Clear(0);
+            double ms = MeasureMs(iterations, [&]() { FillPolygonScanlineParallel(parallel, x.data(), y.data(), count, color, pool); });
+            printf("%-10d %8d %12.3f %9.2fx %10s\n", count, threads, ms, serialMs / ms, serial.pixels == parallel.pixels ? "yes" : "NO");
+        }
+
+        // 线程数超过核数、带数不整除行数时结果也必须相同
+        ThreadPool pool(4);
+        parallel.Clear(0);
+        FillPolygonScanlineParallel(parallel, x.data(), y.data(), count, color, pool, 257);
+        printf("%-10d %8s %12s %10s %10s\n", count, "4x257", "-", "-", serial.pixels == parallel.pixels ? "yes" : "NO");
+    }
+    printf("\n");
+
+    printf("== Band-parallel edge flag fill (%dx%d, %d hardware threads) ==\n", width, height, hardware);
+    printf("%-10s %8s %12s %10s %10s\n", "vertices", "threads", "ms", "speedup", "identical");
+
+    EdgeFlagScratch scratch;
+    for (int count : counts) {
+        std::vector<float> x, y;
+        MakeStarPolygon(count, 0.0f, 0.0f, x, y, static_cast<unsigned>(count));
+        for (int i = 0; i < count; ++i) {
+            x[i] = width * 0.5f + x[i] * 0.5f;
+            y[i] = height * 0.5f + y[i] * 8.0f;
+        }
+        int iterations = count > 100000 ? 3 : 20;
+
+        serial.Clear(0);
+        double serialMs = MeasureMs(iterations, [&]() { FillPolygonEdgeFlag(serial, x.data(), y.data(), count, color, scratch); });
+        printf("%-10d %8s %12.3f %10s %10s\n", count, "serial", serialMs, "1.00x", "-");
+
+        for (int threads = 1; threads <= hardware; threads *= 2) {
+            ThreadPool pool(threads);
+            parallel.Clear(0);
+            double ms = MeasureMs(iterations, [&]() { FillPolygonEdgeFlagParallel(parallel, x.data(), y.data(), count, color, pool); });
+            printf("%-10d %8d %12.3f %9.2fx %10s\n", count, threads, ms, serialMs / ms, serial.pixels == parallel.pixels ? "yes" : "NO");
+        }
+
+        ThreadPool pool(4);
+        parallel.Clear(0);
+        FillPolygonEdgeFlagParallel(parallel, x.data(), y.data(), count, color, pool, 257);
+        printf("%-10d %8s %12s %10s %10s\n", count, "4x257", "-", "-", serial.pixels == parallel.pixels ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// 分块填充的逐行参考实现：与 FillSceneTiled 相同的采样规则，每行把交点排序后按填充规则求区间
+static void FillSceneReference(PixelBuffer& target, const FillScene& scene)
+{
+    std::vector<TileRasterScratch::Edge> edges;
+    std::vector<std::pair<float, int>> crossings;
+    for (int fill = 0; fill < static_cast<int>(scene.fills.size()); ++fill) {
+        edges.clear();
+        for (int c = 0; c < scene.ContourCount(); ++c) {
+            if (scene.contour_fill[c] != fill)
+                continue;
+            const int first = scene.contour_start[c];
+            const int last = scene.contour_start[c + 1];
+            for (int i = first; i < last && last - first >= 3; ++i) {
+                int next = (i + 1) == last ? first : i + 1;
+                float x0 = scene.x[i], y0 = scene.y[i], x1 = scene.x[next], y1 = scene.y[next];
+                if (y0 == y1)
+                    continue;
+                int winding = 1;
+                if (y0 > y1) {
+                    std::swap(x0, x1);
+                    std::swap(y0, y1);
+                    winding = -1;
+                }
+                TileRasterScratch::Edge edge {};
+                edge.x0 = x0;
+                edge.y0 = y0;
+                edge.dx = (x1 - x0) / (y1 - y0);
+                edge.row0 = static_cast<int>(std::ceil(y0));
+                edge.row1 = static_cast<int>(std::ceil(y1));
+                edge.winding = winding;
+                edges.push_back(edge);
+            }
+        }
+
+        const bool nonzero = scene.fills[fill].rule == FILL_NONZERO;
+        for (int row = 0; row < target.height; ++row) {
+            crossings.clear();
+            for (const TileRasterScratch::Edge& edge : edges) {
+                if (edge.row0 <= row && row < edge.row1)
+                    crossings.emplace_back(TileEdgeX(edge, row), edge.winding);
+            }
+            std::sort(crossings.begin(), crossings.end());
+            int winding = 0;
+            for (size_t i = 0; i < crossings.size(); ++i) {
+                winding += crossings[i].second;
+                bool inside = nonzero ? winding != 0 : (winding & 1) != 0;
+                if (!inside || i + 1 == crossings.size())
+                    continue;
+                // 交点在 [xc_i, xc_{i+1}) 之间的整数像素
+                float from = std::max(std::ceil(crossings[i].first), 0.0f);
+                float to = std::min(std::ceil(crossings[i + 1].first) - 1.0f, static_cast<float>(target.width - 1));
+                if (from <= to)
+                    target.PlotSpan(static_cast<int>(from), static_cast<int>(to), row, scene.fills[fill].color);
+            }
+        }
+    }
+}
+
+static int CountDiff(const PixelBuffer& a, const PixelBuffer& b)
+{
+    int diff = 0;
+    for (size_t i = 0; i < a.pixels.size(); ++i)
+        diff += a.pixels[i] != b.pixels[i];
+    return diff;
+}
+
+// 分块覆盖掩码填充与扫描线场景填充的对比：区域越小越密，分块越有利
+static void BenchTiledFill()
+{
+    const int size = 2048;
+    const int hardware = std::max(1u, std::thread::hardware_concurrency());
+    PixelBuffer scanline(size, size);
+    PixelBuffer tiled(size, size);
+    PixelBuffer reference(size, size);
+
+    printf("== Tiled coverage-mask fill vs scene scanline (2048x2048, 8x8 tiles) ==\n");
+    printf("%-10s %8s %12s %10s %14s %12s\n", "polygons", "threads", "ms", "speedup", "vs scanline", "vs exact");
+
+    const int grids[] = { 100, 300 };
+    for (int grid : grids) {
+        FillScene scene;
+        MakeMapScene(grid, size, scene);
+
+        ScanlineScratch scratch;
+        scanline.Clear(0);
+        double scanlineMs = MeasureMs(5, [&]() { FillSceneScanline(scanline, scene, scratch); });
+        printf("%-10d %8s %12.3f %10s %14s %12s\n", grid * grid, "scanline", scanlineMs, "1.00x", "-", "-");
+
+        reference.Clear(0);
+        if (grid <= 100)
+            FillSceneReference(reference, scene);
+
+        for (int threads = 1; threads <= hardware; threads *= 2) {
+            ThreadPool pool(threads);
+            tiled.Clear(0);
+            double ms = MeasureMs(5, [&]() { FillSceneTiled(tiled, scene, pool); });
+            // 与扫描线的差异只在区域边界上（两者的采样规则不同）；与逐行参考实现应完全相同
+            char exact[16];
+            snprintf(exact, sizeof(exact), "%d", CountDiff(tiled, reference));
+            printf("%-10d %8d %12.3f %9.2fx %14d %12s\n", grid * grid, threads, ms, scanlineMs / ms, CountDiff(tiled, scanline), grid <= 100 ? exact : "-");
+        }
+    }
+
+    // 带洞的星形，奇偶与非零规则
+    std::vector<float> x, y, hx, hy;
+    MakeStarPolygon(1000, size * 0.5f, size * 0.5f, x, y, 3);
+    hx.assign(x.rbegin(), x.rend());
+    hy.assign(y.rbegin(), y.rend());
+    for (size_t i = 0; i < hx.size(); ++i) {
+        hx[i] = size * 0.5f + (hx[i] - size * 0.5f) * 0.5f;
+        hy[i] = size * 0.5f + (hy[i] - size * 0.5f) * 0.5f;
+    }
+    ThreadPool pool;
+    const FillRule rules[] = { FILL_EVEN_ODD, FILL_NONZERO };
+    for (int reverse = 0; reverse < 2; ++reverse) {
+        if (reverse) {
+            std::reverse(hx.begin(), hx.end());
+            std::reverse(hy.begin(), hy.end());
+        }
+        for (FillRule rule : rules) {
+            FillScene scene;
+            int fill = scene.AddFill(IM_COL32_WHITE, rule);
+            scene.AddContour(fill, x.data(), y.data(), 1000);
+            scene.AddContour(fill, hx.data(), hy.data(), 1000);
+            scanline.Clear(0);
+            tiled.Clear(0);
+            reference.Clear(0);
+            FillSceneScanline(scanline, scene);
+            double ms = MeasureMs(3, [&]() { FillSceneTiled(tiled, scene, pool); });
+            FillSceneReference(reference, scene);
+            printf("star + %s hole, %-9s %8.3f ms, vs scanline %6d, vs exact %d\n", reverse ? "same-dir" : "reversed",
+                rule == FILL_EVEN_ODD ? "even-odd" : "nonzero", ms, CountDiff(tiled, scanline), CountDiff(tiled, reference));
+        }
+    }
+    printf("\n");
+}
+
+// 边标志法与有序边表法的对比；边标志法的采样规则与逐行参考实现相同，像素应完全一致
+static void BenchEdgeFlag()
+{
+    const int size = 2048;
+    const ImU32 color = IM_COL32(0, 128, 255, 255);
+    PixelBuffer ordered(size, size);
+    PixelBuffer flagged(size, size);
+    PixelBuffer reference(size, size);
+    EdgeFlagScratch scratch;
+
+    printf("== Edge flag fill vs ordered edge table (2048x2048) ==\n");
+    printf("%-10s %14s %14s %10s %12s %10s\n", "vertices", "CSR+AET ms", "edge flag ms", "speedup", "vs scanline", "vs exact");
+
+    const int counts[] = { 6, 1000, 10000, 100000, 1000000 };
+    for (int count : counts) {
+        std::vector<float> x, y;
+        if (count == 6) {
+            // exp7 的默认六边形，放大到整个缓冲区
+            x = { 1576.0f, 1288.0f, 712.0f, 424.0f, 712.0f, 1288.0f };
+            y = { 1000.0f, 1292.0f, 1292.0f, 1000.0f, 708.0f, 708.0f };
+        } else {
+            MakeStarPolygon(count, size * 0.5f, size * 0.5f, x, y, static_cast<unsigned>(count));
+        }
+        int iterations = std::max(2, 20000 / count);
+
+        ordered.Clear(0);
+        flagged.Clear(0);
+        double orderedMs = MeasureMs(iterations, [&]() { DrawPolygonWithOrderedEdgeTable(ordered, x, y, count, color); });
+        double flagMs = MeasureMs(iterations, [&]() { FillPolygonEdgeFlag(flagged, x.data(), y.data(), count, color, scratch); });
+
+        char exact[16] = "-";
+        if (count <= 10000) {
+            FillScene scene;
+            scene.AddContour(scene.AddFill(color), x.data(), y.data(), count);
+            reference.Clear(0);
+            FillSceneReference(reference, scene);
+            snprintf(exact, sizeof(exact), "%d", CountDiff(flagged, reference));
+        }
+        printf("%-10d %14.3f %14.3f %9.2fx %12d %10s\n", count, orderedMs, flagMs, orderedMs / flagMs, CountDiff(flagged, ordered), exact);
+    }
+
+    // 超出缓冲区的多边形只处理可见部分；非 PixelBuffer 目标逐段输出
+    std::vector<float> x, y;
+    MakeStarPolygon(1000, 0.0f, size * 0.5f, x, y, 7);
+    flagged.Clear(0);
+    reference.Clear(0);
+    FillPolygonEdgeFlag(flagged, x.data(), y.data(), 1000, color, scratch);
+    FillScene scene;
+    scene.AddContour(scene.AddFill(color), x.data(), y.data(), 1000);
+    FillSceneReference(reference, scene);
+    SpanRecorder spans;
+    FillPolygonEdgeFlag(spans, x.data(), y.data(), 1000, color, scratch);
+    ordered.Clear(0);
+    for (const SpanRecorder::Span& span : spans.spans)
+        ordered.PlotSpan(span.x0, span.x1, span.y, color);
+    printf("clipped star vs exact %d, PlotSpan output vs exact %d\n\n", CountDiff(flagged, reference), CountDiff(ordered, reference));
+}
+
+// 原来的抗锯齿方式：在 factor 倍分辨率下做无抗锯齿填充，再把每 factor x factor 个子像素平均成覆盖率（0..255）
+// 用采样规则精确的边标志法，并平移半个子像素，让采样点落在子像素中心
+static void FillPolygonSupersampled(std::vector<int>& coverage, PixelBuffer& hires, int size, int factor,
+    const std::vector<float>& x, const std::vector<float>& y, EdgeFlagScratch& scratch)
+{
+    std::vector<float> sx(x.size()), sy(y.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        sx[i] = x[i] * factor - 0.5f;
+        sy[i] = y[i] * factor - 0.5f;
+    }
+    hires.Resize(size * factor, size * factor);
+    hires.Clear(0);
+    FillPolygonEdgeFlag(hires, sx.data(), sy.data(), static_cast<int>(sx.size()), IM_COL32_WHITE, scratch);
+
+    coverage.assign(static_cast<size_t>(size) * size, 0);
+    const int samples = factor * factor;
+    for (int py = 0; py < size; ++py) {
+        for (int sy0 = 0; sy0 < factor; ++sy0) {
+            const ImU32* row = hires.pixels.data() + static_cast<size_t>(py * factor + sy0) * hires.width;
+            for (int px = 0; px < size; ++px) {
+                int count = 0;
+                for (int k = 0; k < factor; ++k)
+                    count += row[px * factor + k] != 0;
+                coverage[static_cast<size_t>(py) * size + px] += count;
+            }
+        }
+    }
+    for (int& c : coverage)
+        c = (c * 255 + samples / 2) / samples;
+}
+
+// 解析覆盖率填充与超采样的对比，误差以 16x16 超采样为参考（白色画在黑色上，覆盖率即 R 通道）
+static void BenchCoverageFill()
+{
+    const int size = 1024;
+    PixelBuffer buffer(size, size);
+    PixelBuffer hires;
+    EdgeFlagScratch flagScratch;
+    CoverageScratch scratch;
+    std::vector<int> coverage, reference;
+
+    printf("== Analytic coverage fill vs supersampling (1024x1024) ==\n");
+    printf("%-10s %-14s %12s %10s %12s %12s\n", "vertices", "method", "ms", "speedup", "mean error", "max error");
+
+    const int counts[] = { 6, 1000, 10000 };
+    for (int count : counts) {
+        std::vector<float> x, y;
+        if (count == 6) {
+            x = { 788.0f, 644.0f, 356.0f, 212.0f, 356.0f, 644.0f };
+            y = { 500.0f, 646.0f, 646.0f, 500.0f, 354.0f, 354.0f };
+            for (size_t i = 0; i < x.size(); ++i) {
+                x[i] += 0.3f * i;
+                y[i] += 0.7f * i;
+            }
+        } else {
+            MakeStarPolygon(count, size * 0.5f, size * 0.5f, x, y, static_cast<unsigned>(count));
+            for (size_t i = 0; i < x.size(); ++i) {
+                x[i] = size * 0.5f + (x[i] - size * 0.5f) * 0.5f;
+                y[i] = size * 0.5f + (y[i] - size * 0.5f) * 0.5f;
+            }
+        }
+        FillPolygonSupersampled(reference, hires, size, 16, x, y, flagScratch);
+
+        auto report = [&](const char* name, double ms, double baseMs, const std::vector<int>& result) {
+            double sum = 0.0;
+            int worst = 0;
+            for (size_t i = 0; i < result.size(); ++i) {
+                int e = std::abs(result[i] - reference[i]);
+                sum += e;
+                worst = std::max(worst, e);
+            }
+            // 误差按边缘像素（参考覆盖率不为 0 也不为 255）平均
+            int edge = 0;
+            for (int r : reference)
+                edge += r != 0 && r != 255;
+            printf("%-10d %-14s %12.3f %9.2fx %12.2f %12d\n", count, name, ms, baseMs / ms, sum / std::max(edge, 1), worst);
+        };
+
+        const int factors[] = { 4, 2 };
+        double baseMs = 0.0;
+        for (int factor : factors) {
+            double ms = MeasureMs(5, [&]() { FillPolygonSupersampled(coverage, hires, size, factor, x, y, flagScratch); });
+            if (factor == 4)
+                baseMs = ms;
+            char name[16];
+            snprintf(name, sizeof(name), "%dx%d SSAA", factor, factor);
+            report(name, ms, baseMs, coverage);
+        }
+
+        buffer.Clear(IM_COL32_BLACK);
+        double ms = MeasureMs(5, [&]() {
+            buffer.Clear(IM_COL32_BLACK);
+            FillPolygonCoverage(buffer, x.data(), y.data(), count, IM_COL32_WHITE, FILL_EVEN_ODD, scratch);
+        });
+        coverage.resize(buffer.pixels.size());
+        for (size_t i = 0; i < buffer.pixels.size(); ++i)
+            coverage[i] = buffer.pixels[i] & 0xFF;
+        report("analytic", ms, baseMs, coverage);
+    }
+    printf("\n");
+}
+
+// 朴素的 4 连通泛洪填充：每个像素检查后把四个邻居逐个压栈
+static int FloodFill4Naive(PixelBuffer& buffer, int x, int y, ImU32 boundary_color, ImU32 fill_color, std::vector<PixelCoord>& stack)
+{
+    int count = 0;
+    stack.clear();
+    stack.push_back({ x, y });
+    while (!stack.empty()) {
+        PixelCoord p = stack.back();
+        stack.pop_back();
+        if (!buffer.Contains(p.x, p.y))
+            continue;
+        ImU32& c = buffer.pixels[static_cast<size_t>(p.y) * buffer.width + p.x];
+        if (c == boundary_color || c == fill_color)
+            continue;
+        c = fill_color;
+        ++count;
+        stack.push_back({ p.x + 1, p.y });
+        stack.push_back({ p.x - 1, p.y });
+        stack.push_back({ p.x, p.y + 1 });
+        stack.push_back({ p.x, p.y - 1 });
+    }
+    return count;
+}
+
+// 扫描线种子填充与朴素泛洪填充的对比，两者填充的像素应完全相同
+static void BenchSeedFill()
+{
+    const int size = 2048;
+    const ImU32 boundary = IM_COL32_BLACK;
+    const ImU32 fill = IM_COL32(255, 0, 0, 255);
+    PixelBuffer scene(size, size), spanBuffer(size, size), naiveBuffer(size, size);
+
+    printf("== Span seed fill vs naive 4-connected flood fill (2048x2048) ==\n");
+    printf("%-12s %10s %12s %12s %10s %14s %10s\n", "region", "pixels", "naive ms", "span ms", "speedup", "max stack", "identical");
+
+    for (int kind = 0; kind < 2; ++kind) {
+        SeedFillScratch scratch;
+        std::vector<PixelCoord> naiveStack; // 栈的容量即最大深度（按 2 的幂增长）
+        scene.Clear(IM_COL32_WHITE);
+        if (kind == 0) {
+            // 凹的星形边界
+            std::vector<float> x, y;
+            MakeStarPolygon(1000, size * 0.5f, size * 0.5f, x, y, 5);
+            for (int i = 0; i < 1000; ++i)
+                DrawLineBresenham(scene, ImVec2(x[i], y[i]), ImVec2(x[(i + 1) % 1000], y[(i + 1) % 1000]), boundary);
+        } else {
+            // 蛇形迷宫：每隔 2 行一道墙，缺口左右交替，通道只有一行高
+            for (int row = 1; row < size; row += 2) {
+                bool gapLeft = (row / 2) % 2 == 1;
+                scene.PlotSpan(gapLeft ? 2 : 0, gapLeft ? size - 1 : size - 3, row, boundary);
+            }
+        }
+        const int seedX = size / 2;
+        const int seedY = kind == 0 ? size / 2 : 0;
+
+        int naiveCount = 0, spanCount = 0;
+        double naiveMs = MeasureMs(3, [&]() {
+            naiveBuffer.pixels = scene.pixels;
+            naiveCount = FloodFill4Naive(naiveBuffer, seedX, seedY, boundary, fill, naiveStack);
+        });
+        double spanMs = MeasureMs(3, [&]() {
+            spanBuffer.pixels = scene.pixels;
+            spanCount = SeedFillBoundaryColor(spanBuffer, seedX, seedY, boundary, fill, scratch);
+        });
+        // 复制场景的耗时两边相同，从结果中扣除
+        double copyMs = MeasureMs(3, [&]() { spanBuffer.pixels = scene.pixels; });
+        spanBuffer.pixels = scene.pixels;
+        SeedFillBoundaryColor(spanBuffer, seedX, seedY, boundary, fill, scratch);
+
+        char stack[32];
+        snprintf(stack, sizeof(stack), "%zu/%zu", scratch.stack.capacity(), naiveStack.capacity());
+        printf("%-12s %10d %12.3f %12.3f %9.2fx %14s %10s\n", kind == 0 ? "star" : "maze", spanCount, naiveMs - copyMs, spanMs - copyMs,
+            (naiveMs - copyMs) / (spanMs - copyMs), stack, naiveCount == spanCount && naiveBuffer.pixels == spanBuffer.pixels ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// O(n^2) 的耳切法：每次扫描剩余顶点找到一个耳朵（凸角且三角形内没有其他顶点）切掉
+static bool TriangulateEarClipping(const std::vector<ImVec2>& points, std::vector<int>& indices)
+{
+    const int n = static_cast<int>(points.size());
+    std::vector<int> remaining(n);
+    float area = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        remaining[i] = i;
+        area += points[i].x * points[(i + 1) % n].y - points[i].y * points[(i + 1) % n].x;
+    }
+    if (area < 0.0f)
+        std::reverse(remaining.begin(), remaining.end());
+    auto cross = [&](int a, int b, int c) {
+        return (points[b].x - points[a].x) * (points[c].y - points[a].y) - (points[b].y - points[a].y) * (points[c].x - points[a].x);
+    };
+    indices.clear();
+    while (remaining.size() > 3) {
+        const int m = static_cast<int>(remaining.size());
+        bool clipped = false;
+        for (int i = 0; i < m && !clipped; ++i) {
+            int a = remaining[(i + m - 1) % m], b = remaining[i], c = remaining[(i + 1) % m];
+            if (cross(a, b, c) <= 0.0f)
+                continue;
+            bool ear = true;
+            for (int j = 0; j < m && ear; ++j) {
+                int p = remaining[j];
+                if (p == a || p == b || p == c)
+                    continue;
+                ear = !(cross(a, b, p) >= 0.0f && cross(b, c, p) >= 0.0f && cross(c, a, p) >= 0.0f);
+            }
+            if (ear) {
+                indices.insert(indices.end(), { a, b, c });
+                remaining.erase(remaining.begin() + i);
+                clipped = true;
+            }
+        }
+        if (!clipped)
+            return false;
+    }
+    indices.insert(indices.end(), remaining.begin(), remaining.end());
+    return true;
+}
+
+// 单调划分三角化与耳切法的对比，以及缓存命中时的开销
+static void BenchTriangulate()
+{
+    printf("== Monotone partition triangulation vs ear clipping ==\n");
+    printf("%-10s %12s %12s %10s %12s %10s\n", "vertices", "ear ms", "monotone ms", "speedup", "cached ms", "area ok");
+
+    TriangulationScratch scratch;
+    TriangulationCache cache;
+    std::vector<int> indices;
+    const int counts[] = { 8, 100, 1000, 10000 };
+    for (int count : counts) {
+        std::vector<float> x, y;
+        MakeStarPolygon(count, 1000.0f, 1000.0f, x, y, static_cast<unsigned>(count));
+        std::vector<ImVec2> points(count);
+        for (int i = 0; i < count; ++i)
+            points[i] = ImVec2(x[i], y[i]);
+        int iterations = std::max(1, 20000 / count);
+
+        double earMs = count <= 1000 ? MeasureMs(iterations, [&]() { TriangulateEarClipping(points, indices); }) : 0.0;
+        double monotoneMs = MeasureMs(iterations, [&]() { TriangulatePolygon(points.data(), count, indices, scratch); });
+        cache.Triangulate(points.data(), count);
+        double cachedMs = MeasureMs(iterations, [&]() { cache.Triangulate(points.data(), count); });
+
+        // 三角形面积之和应等于多边形面积（没有重叠也没有遗漏）
+        double polygonArea = 0.0, triangleArea = 0.0;
+        for (int i = 0; i < count; ++i)
+            polygonArea += (double)points[i].x * points[(i + 1) % count].y - (double)points[i].y * points[(i + 1) % count].x;
+        for (size_t t = 0; t < indices.size(); t += 3) {
+            const ImVec2 &a = points[indices[t]], &b = points[indices[t + 1]], &c = points[indices[t + 2]];
+            triangleArea += std::abs(((double)b.x - a.x) * ((double)c.y - a.y) - ((double)b.y - a.y) * ((double)c.x - a.x));
+        }
+        bool areaOk = std::abs(triangleArea - std::abs(polygonArea)) <= 1e-4 * std::abs(polygonArea);
+
+        char ear[32] = "-", speedup[32] = "-";
+        if (count <= 1000) {
+            snprintf(ear, sizeof(ear), "%.3f", earMs);
+            snprintf(speedup, sizeof(speedup), "%.2fx", earMs / monotoneMs);
+        }
+        printf("%-10d %12s %12.3f %10s %12.4f %10s\n", count, ear, monotoneMs, speedup, cachedMs, areaOk ? "yes" : "NO");
+    }
+    printf("cache hits %zu, misses %zu, %zu bytes\n", cache.hits, cache.misses, cache.MemoryBytes());
+
+    // 直接写入绘制列表：n 个顶点、3(n - 2) 个索引，与 AddConvexPolyFilled 的非抗锯齿路径一样多
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ResetDrawList(draw_list);
+    std::vector<float> x, y;
+    MakeStarPolygon(1000, 1000.0f, 1000.0f, x, y, 1);
+    std::vector<ImVec2> star(1000);
+    for (int i = 0; i < 1000; ++i)
+        star[i] = ImVec2(x[i], y[i]);
+    DrawPolygonFilledTriangulated(&draw_list, ImVec2(0.0f, 0.0f), star, IM_COL32_WHITE, cache);
+    printf("draw list: %d vertices, %d indices\n\n", draw_list.VtxBuffer.Size, draw_list.IdxBuffer.Size);
+}
+
+// 逐点扫描所有边的射线法，采样规则与 PolygonIndex 相同
+static bool ContainsNaive(const std::vector<ImVec2>& points, float x, float y)
+{
+    bool inside = false;
+    const int n = static_cast<int>(points.size());
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        ImVec2 a = points[j], b = points[i];
+        if (a.y == b.y)
+            continue;
+        if (a.y > b.y)
+            std::swap(a, b);
+        if (y >= a.y && y < b.y && a.x + (b.x - a.x) / (b.y - a.y) * (y - a.y) <= x)
+            inside = !inside;
+    }
+    return inside;
+}
+
+// 条带索引与逐点扫描所有边的对比：100 万个随机点，以及 2048x2048 的掩码
+static void BenchPolygonIndex()
+{
+    const int size = 2048;
+    const int queryCount = 1000000;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coord(0.0f, static_cast<float>(size));
+    std::vector<ImVec2> queries(queryCount);
+    for (ImVec2& q : queries)
+        q = ImVec2(coord(rng), coord(rng));
+    std::vector<uint8_t> naive(queryCount), indexed(queryCount);
+    std::vector<uint8_t> mask(static_cast<size_t>(size) * size), pointMask(mask.size());
+    ThreadPool pool;
+
+    printf("== Point-in-polygon slab index (1M random points, 2048x2048 mask) ==\n");
+    printf("%-10s %10s %10s %12s %12s %10s %12s %10s\n", "vertices", "build ms", "naive ms", "indexed ms", "parallel ms", "identical", "mask ms", "identical");
+
+    const int counts[] = { 100, 1000, 10000, 100000 };
+    for (int count : counts) {
+        std::vector<float> x, y;
+        MakeStarPolygon(count, size * 0.5f, size * 0.5f, x, y, static_cast<unsigned>(count));
+        std::vector<ImVec2> points(count);
+        for (int i = 0; i < count; ++i)
+            points[i] = ImVec2(x[i], y[i]);
+
+        PolygonIndex index;
+        double buildMs = MeasureMs(3, [&]() { index.Build(points.data(), count); });
+
+        // 逐点扫描太慢，只测一部分点再按比例换算
+        const int naiveCount = std::max(1000, queryCount / count * 100);
+        double naiveMs = MeasureMs(1, [&]() {
+            for (int i = 0; i < naiveCount; ++i)
+                naive[i] = ContainsNaive(points, queries[i].x, queries[i].y);
+        }) * queryCount / naiveCount;
+        double indexedMs = MeasureMs(3, [&]() { index.ContainsBatch(queries.data(), queryCount, indexed.data()); });
+        double parallelMs = MeasureMs(3, [&]() { index.ContainsBatch(queries.data(), queryCount, indexed.data(), pool); });
+        bool same = std::equal(naive.begin(), naive.begin() + naiveCount, indexed.begin());
+
+        double maskMs = MeasureMs(3, [&]() { index.RasterizeMask(0, 0, size, size, mask.data()); });
+        for (int py = 0; py < size; ++py)
+            for (int px = 0; px < size; ++px)
+                pointMask[static_cast<size_t>(py) * size + px] = index.Contains(static_cast<float>(px), static_cast<float>(py));
+
+        printf("%-10d %10.3f %10.1f %12.3f %12.3f %10s %12.3f %10s\n", count, buildMs, naiveMs, indexedMs, parallelMs,
+            same ? "yes" : "NO", maskMs, mask == pointMask ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// exp7 / exp8：参数不变的帧直接回放缓存的像素段
+// 按段转发给另一个目标，并带上它的可见范围；不是 PixelBuffer，RasterCache 会记录和回放它收到的段
+struct SpanForwardingTarget : RasterTarget {
+    RasterTarget& inner;
+
+    explicit SpanForwardingTarget(RasterTarget& inner)
+        : inner(inner)
+    {
+    }
+
+    void Plot(int x, int y, ImU32 color) override { inner.Plot(x, y, color); }
+    void PlotSpan(int x0, int x1, int y, ImU32 color) override { inner.PlotSpan(x0, x1, y, color); }
+    void PlotVSpan(int x, int y0, int y1, ImU32 color) override { inner.PlotVSpan(x, y0, y1, color); }
+
+    bool GetClipRect(int& xmin, int& ymin, int& xmax, int& ymax) const override
+    {
+        return inner.GetClipRect(xmin, ymin, xmax, ymax);
+    }
+};
+
+static void BenchRasterCache()
+{
+    const int size = 2048;
+    const int count = 1000;
+    std::vector<float> x, y;
+    MakeStarPolygon(count, size * 0.5f, size * 0.5f, x, y, 3);
+    const ImU32 color = IM_COL32(0, 0, 255, 255);
+    PixelBuffer direct(size, size), cached(size, size);
+    // 缓存只记录按段接收像素的目标，PixelBuffer 要经过一层转发
+    SpanForwardingTarget directForward(direct), cachedForward(cached);
+    ScanlineScratch scanlineScratch;
+    EdgeFlagScratch edgeFlagScratch;
+    CoverageScratch coverageScratch;
+
+    printf("== Raster cache: replay vs rerun (1000-vertex star, 2048x2048) ==\n");
+    printf("%-20s %10s %10s %10s %10s %10s %10s\n", "algorithm", "rerun ms", "replay ms", "speedup", "hit rate", "KB", "identical");
+
+    struct Case {
+        const char* name;
+        int id;
+        std::function<void(RasterTarget&)> rasterize;
+    };
+    const Case algorithms[] = {
+        { "ordered edge table", RASTER_ORDERED_EDGE_TABLE, [&](RasterTarget& t) { FillPolygonScanline(t, x.data(), y.data(), count, color, scanlineScratch); } },
+        { "edge flag", RASTER_EDGE_FLAG, [&](RasterTarget& t) { FillPolygonEdgeFlag(t, x.data(), y.data(), count, color, edgeFlagScratch); } },
+        { "coverage", RASTER_COVERAGE, [&](RasterTarget& t) { FillPolygonCoverage(t, x.data(), y.data(), count, color, FILL_EVEN_ODD, coverageScratch); } },
+    };
+    // 清空画布的耗时两边相同，从结果中扣除
+    double clearMs = MeasureMs(10, [&]() { direct.Clear(0); });
+    for (const Case& algorithm : algorithms) {
+        RasterCache cache;
+        cache.DrawPolygon(cachedForward, algorithm.id, color, x.data(), y.data(), count, algorithm.rasterize);
+        double rerunMs = MeasureMs(10, [&]() {
+            direct.Clear(0);
+            algorithm.rasterize(directForward);
+        });
+        double replayMs = MeasureMs(10, [&]() {
+            cached.Clear(0);
+            cache.DrawPolygon(cachedForward, algorithm.id, color, x.data(), y.data(), count, algorithm.rasterize);
+        });
+        printf("%-20s %10.3f %10.3f %9.2fx %9.1f%% %10.1f %10s\n", algorithm.name, rerunMs - clearMs, replayMs - clearMs,
+            (rerunMs - clearMs) / (replayMs - clearMs), 100.0 * cache.HitRate(), cache.MemoryBytes() / 1024.0,
+            direct.pixels == cached.pixels ? "yes" : "NO");
+    }
+
+    // 直接画到 PixelBuffer 时算法按覆盖率和半透明颜色混合，缓存不经过记录，结果与不用缓存相同
+    {
+        const ImU32 translucent = IM_COL32(255, 0, 0, 128);
+        RasterCache cache;
+        direct.Clear(IM_COL32(0, 0, 255, 255));
+        cached.Clear(IM_COL32(0, 0, 255, 255));
+        FillPolygonCoverage(direct, x.data(), y.data(), count, translucent, FILL_EVEN_ODD, coverageScratch);
+        for (int i = 0; i < 2; ++i) {
+            cached.Clear(IM_COL32(0, 0, 255, 255));
+            cache.DrawPolygon(cached, RASTER_COVERAGE, translucent, x.data(), y.data(), count,
+                [&](RasterTarget& t) { FillPolygonCoverage(t, x.data(), y.data(), count, translucent, FILL_EVEN_ODD, coverageScratch); });
+        }
+        printf("translucent coverage on PixelBuffer: %zu entries, identical: %s\n", cache.EntryCount(),
+            direct.pixels == cached.pixels ? "yes" : "NO");
+    }
+
+    // 画布随窗口每帧移动：像素坐标相对画布原点，由目标的 origin 平移；窗口的裁剪矩形跟着移动，所以仍然命中
+    {
+        ImDrawList directList(ImGui::GetDrawListSharedData()), cachedList(ImGui::GetDrawListSharedData());
+        RasterCache cache;
+        bool same = true;
+        for (int frame = 0; frame < 60; ++frame) {
+            const ImVec2 origin(10.0f + frame * 3.0f, 20.0f + frame);
+            ResetDrawList(directList);
+            ResetDrawList(cachedList);
+            directList.PushClipRect(origin, ImVec2(origin.x + size, origin.y + size));
+            cachedList.PushClipRect(origin, ImVec2(origin.x + size, origin.y + size));
+            DrawListTarget directTarget(&directList, origin, 0.5f, PIXEL_QUAD);
+            algorithms[1].rasterize(directTarget);
+            DrawListTarget cachedTarget(&cachedList, origin, 0.5f, PIXEL_QUAD);
+            cache.DrawPolygon(cachedTarget, RASTER_EDGE_FLAG, color, x.data(), y.data(), count, algorithms[1].rasterize);
+            same = same && directList.VtxBuffer.Size == cachedList.VtxBuffer.Size
+                && std::memcmp(directList.VtxBuffer.Data, cachedList.VtxBuffer.Data, directList.VtxBuffer.Size * sizeof(ImDrawVert)) == 0;
+        }
+        printf("moving canvas (60 frames): hit rate %.1f%%, draw lists identical: %s\n", 100.0 * cache.HitRate(), same ? "yes" : "NO");
+    }
+
+    // LRU：循环绘制 16 个多边形，预算放得下与放不下全部结果
+    {
+        std::vector<std::vector<float>> xs(16), ys(16);
+        for (int i = 0; i < 16; ++i)
+            MakeStarPolygon(200, size * 0.5f, size * 0.5f, xs[i], ys[i], 100 + i);
+        RasterCache probe;
+        for (int i = 0; i < 16; ++i)
+            probe.DrawPolygon(cachedForward, RASTER_EDGE_FLAG, color, xs[i].data(), ys[i].data(), 200,
+                [&](RasterTarget& t) { FillPolygonEdgeFlag(t, xs[i].data(), ys[i].data(), 200, color, edgeFlagScratch); });
+        const size_t budgets[] = { probe.MemoryBytes(), probe.MemoryBytes() / 2 };
+        for (size_t budget : budgets) {
+            RasterCache cache(budget);
+            for (int frame = 0; frame < 64; ++frame) {
+                const int i = frame % 16;
+                cache.DrawPolygon(cachedForward, RASTER_EDGE_FLAG, color, xs[i].data(), ys[i].data(), 200,
+                    [&](RasterTarget& t) { FillPolygonEdgeFlag(t, xs[i].data(), ys[i].data(), 200, color, edgeFlagScratch); });
+            }
+            printf("16 polygons cycled, budget %7.1f KB: hit rate %5.1f%%, %zu entries, %.1f KB\n", budget / 1024.0,
+                100.0 * cache.HitRate(), cache.EntryCount(), cache.MemoryBytes() / 1024.0);
+        }
+    }
+    printf("\n");
+}
+
+// exp10：逐条 Cohen-Sutherland 与 SoA 批量裁剪
+static void BenchBatchClip()
+{
+    const float xmin = 0.0f, ymin = 0.0f, xmax = 1280.0f, ymax = 720.0f;
+    const int lineCount = 2000000;
+    std::mt19937 rng(41);
+
+    printf("== Batch Cohen-Sutherland (%d segments, 1280x720 window, %s kernel) ==\n", lineCount, LineClipKernelName());
+    printf("%-16s %10s %12s %12s %10s %10s\n", "segments", "kept", "scalar ms", "batch ms", "speedup", "identical");
+
+    // 细分后的短线段（长度不超过 32 像素），散布范围越大，直接舍弃的越多；范围在窗口内时全部直接接受
+    // 最后一组是跨越窗口的长线段，几乎每条都要求交
+    const float spreads[] = { 0.0f, 0.5f, 2.0f, 0.5f };
+    const float lengths[] = { 32.0f, 32.0f, 32.0f, 2000.0f };
+    const char* names[] = { "inside", "mixed", "mostly outside", "long crossing" };
+    for (int k = 0; k < 4; ++k) {
+        std::uniform_real_distribution<float> px(-spreads[k] * xmax, (1.0f + spreads[k]) * xmax);
+        std::uniform_real_distribution<float> py(-spreads[k] * ymax, (1.0f + spreads[k]) * ymax);
+        std::uniform_real_distribution<float> offset(-lengths[k], lengths[k]);
+        LineSegmentsSoA lines, scalar, batch;
+        lines.Reserve(lineCount);
+        for (int i = 0; i < lineCount; ++i) {
+            ImVec2 start(px(rng), py(rng));
+            ImVec2 end(start.x + offset(rng), start.y + offset(rng));
+            if (k == 0) // 全部在窗口内
+                end = ImVec2(std::min(std::max(end.x, xmin), xmax), std::min(std::max(end.y, ymin), ymax));
+            lines.Add(start, end);
+        }
+        std::vector<int> indices;
+
+        double scalarMs = MeasureMs(3, [&]() {
+            scalar.Clear();
+            for (size_t i = 0; i < lines.Size(); ++i) {
+                float x0 = lines.x0[i], y0 = lines.y0[i], x1 = lines.x1[i], y1 = lines.y1[i];
+                if (CohenSutherlandLineClip(x0, y0, x1, y1, xmin, ymin, xmax, ymax))
+                    scalar.Add(ImVec2(x0, y0), ImVec2(x1, y1));
+            }
+        });
+        double batchMs = MeasureMs(3, [&]() { ClipLinesCohenSutherland(lines, xmin, ymin, xmax, ymax, batch, &indices); });
+        bool same = scalar.x0 == batch.x0 && scalar.y0 == batch.y0 && scalar.x1 == batch.x1 && scalar.y1 == batch.y1;
+        printf("%-16s %10zu %12.3f %12.3f %9.2fx %10s\n", names[k], batch.Size(), scalarMs, batchMs, scalarMs / batchMs, same ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// exp10：三种裁剪算法在不同线段分布下的批量耗时
+static void BenchLineClipAlgorithms()
+{
+    const int lineCount = 2000000;
+    LineClipWindow rect { 0.0f, 0.0f, 1280.0f, 720.0f, {} };
+    LineClipWindow octagon = rect;
+    for (int k = 0; k < 8; ++k) {
+        float a = k * 0.78539816f;
+        octagon.polygon.push_back(ImVec2(640.0f + 600.0f * std::cos(a), 360.0f + 340.0f * std::sin(a)));
+    }
+    std::mt19937 rng(43);
+
+    printf("== Line clipping algorithms (%d segments, 1280x720 window, %s kernel, batch ms) ==\n", lineCount, LineClipKernelName());
+    printf("%-16s %18s %18s %18s %18s\n", "distribution", "Cohen-Sutherland", "Liang-Barsky", "Cyrus-Beck (rect)", "Cyrus-Beck (oct)");
+
+    // random：端点在窗口周围 3 倍范围内随机，多数线段跨越边界
+    // mostly inside / mostly outside：长度不超过 32 像素的短线段，约 90% 在窗口内 / 窗口外
+    const char* names[] = { "random", "mostly inside", "mostly outside" };
+    for (int kind = 0; kind < 3; ++kind) {
+        LineSegmentsSoA lines, out;
+        lines.Reserve(lineCount);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        std::uniform_real_distribution<float> offset(-32.0f, 32.0f);
+        for (int i = 0; i < lineCount; ++i) {
+            if (kind == 0) {
+                lines.Add(ImVec2((unit(rng) * 3.0f - 1.0f) * 1280.0f, (unit(rng) * 3.0f - 1.0f) * 720.0f),
+                    ImVec2((unit(rng) * 3.0f - 1.0f) * 1280.0f, (unit(rng) * 3.0f - 1.0f) * 720.0f));
+                continue;
+            }
+            // 窗口内的点取在中间，窗口外的点取在窗口外 64 像素以上，短线段基本不会跨越边界
+            bool inside = (unit(rng) < 0.9f) == (kind == 1);
+            ImVec2 start;
+            if (inside) {
+                start = ImVec2(64.0f + unit(rng) * 1152.0f, 64.0f + unit(rng) * 592.0f);
+            } else {
+                float side = unit(rng);
+                start = side < 0.5f ? ImVec2(unit(rng) < 0.5f ? -64.0f - unit(rng) * 1000.0f : 1344.0f + unit(rng) * 1000.0f, unit(rng) * 720.0f)
+                                    : ImVec2(unit(rng) * 1280.0f, unit(rng) < 0.5f ? -64.0f - unit(rng) * 1000.0f : 784.0f + unit(rng) * 1000.0f);
+            }
+            lines.Add(start, ImVec2(start.x + offset(rng), start.y + offset(rng)));
+        }
+
+        const LineClipAlgorithm algorithms[] = { LINE_CLIP_COHEN_SUTHERLAND, LINE_CLIP_LIANG_BARSKY, LINE_CLIP_CYRUS_BECK, LINE_CLIP_CYRUS_BECK };
+        const LineClipWindow* windows[] = { &rect, &rect, &rect, &octagon };
+        char cells[4][32];
+        for (int a = 0; a < 4; ++a) {
+            size_t kept = 0;
+            double ms = MeasureMs(3, [&]() { kept = ClipLines(algorithms[a], lines, *windows[a], out); });
+            snprintf(cells[a], sizeof(cells[a]), "%.2f (%zu)", ms, kept);
+        }
+        printf("%-16s %18s %18s %18s %18s\n", names[kind], cells[0], cells[1], cells[2], cells[3]);
+    }
+    printf("(kept segments in parentheses)\n\n");
+}
+
+// 原来的 Sutherland-Hodgman 实现：每一步都复制一次顶点数组（中间结果为空时提前结束，原来的实现在这里会越界）
+static std::vector<ImVec2> SutherlandHodgmanCopying(const std::vector<ImVec2>& polygon, const ClipWindow& clipWindow)
+{
+    std::vector<ImVec2> inputList = polygon;
+    std::vector<ImVec2> outputList;
+    for (int edge = 0; edge < 4 && !inputList.empty(); ++edge) {
+        outputList.clear();
+        ImVec2 prevPoint = inputList.back();
+        for (const ImVec2& curPoint : inputList) {
+            ImVec2 d(curPoint.x - prevPoint.x, curPoint.y - prevPoint.y);
+            bool curInside = IsInside(curPoint, clipWindow, edge);
+            bool prevInside = IsInside(prevPoint, clipWindow, edge);
+            if (curInside != prevInside) {
+                if (edge < 2) {
+                    float x = edge == 0 ? clipWindow.x0 : clipWindow.x1;
+                    outputList.push_back(ImVec2(x, prevPoint.y + d.y * (x - prevPoint.x) / d.x));
+                } else {
+                    float y = edge == 2 ? clipWindow.y0 : clipWindow.y1;
+                    outputList.push_back(ImVec2(prevPoint.x + d.x * (y - prevPoint.y) / d.y, y));
+                }
+            }
+            if (curInside)
+                outputList.push_back(curPoint);
+            prevPoint = curPoint;
+        }
+        inputList = outputList;
+    }
+    return inputList;
+}
+
+// exp11：10 万个小多边形裁剪到 1280x720 的窗口，逐个分配的原实现与复用缓冲的批量裁剪对比
+static void BenchPolygonClip()
+{
+    const int polygonCount = 100000;
+    const ClipWindow clipWindow = { 0.0f, 0.0f, 1280.0f, 720.0f };
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    printf("== Sutherland-Hodgman polygon clipping (%d polygons, 1280x720 window) ==\n", polygonCount);
+    printf("%-16s %10s %12s %12s %12s %10s\n", "distribution", "vertices", "copying ms", "scratch ms", "batch ms", "identical");
+
+    // mostly inside：多边形中心都在窗口内，约 10% 跨越边界；scattered：中心在窗口周围 3 倍范围内随机
+    const char* names[] = { "mostly inside", "scattered" };
+    for (int kind = 0; kind < 2; ++kind) {
+        std::vector<ImVec2> points;
+        std::vector<int> start(1, 0);
+        for (int i = 0; i < polygonCount; ++i) {
+            const int n = 3 + static_cast<int>(unit(rng) * 14.0f);
+            const float radius = 4.0f + unit(rng) * 28.0f;
+            const ImVec2 center = kind == 0 ? ImVec2(unit(rng) * 1280.0f, unit(rng) * 720.0f)
+                                            : ImVec2((unit(rng) * 3.0f - 1.0f) * 1280.0f, (unit(rng) * 3.0f - 1.0f) * 720.0f);
+            for (int k = 0; k < n; ++k) {
+                const float a = 6.2831853f * k / n;
+                const float r = radius * (k % 2 ? 0.5f : 1.0f);
+                points.push_back(ImVec2(center.x + r * std::cos(a), center.y + r * std::sin(a)));
+            }
+            start.push_back(static_cast<int>(points.size()));
+        }
+
+        std::vector<std::vector<ImVec2>> polygons(polygonCount), copying(polygonCount);
+        for (int i = 0; i < polygonCount; ++i)
+            polygons[i].assign(points.begin() + start[i], points.begin() + start[i + 1]);
+
+        double copyingMs = MeasureMs(3, [&]() {
+            for (int i = 0; i < polygonCount; ++i)
+                copying[i] = SutherlandHodgmanCopying(polygons[i], clipWindow);
+        });
+        PolygonClipScratch scratch;
+        std::vector<ImVec2> single;
+        double scratchMs = MeasureMs(3, [&]() {
+            for (int i = 0; i < polygonCount; ++i)
+                ClipPolygonSutherlandHodgman(points.data() + start[i], start[i + 1] - start[i], clipWindow, single, scratch);
+        });
+        std::vector<ImVec2> outPoints;
+        std::vector<int> outStart;
+        double batchMs = MeasureMs(3, [&]() {
+            ClipPolygonsSutherlandHodgman(points.data(), start.data(), polygonCount, clipWindow, outPoints, outStart, scratch);
+        });
+
+        bool same = true;
+        for (int i = 0; i < polygonCount && same; ++i) {
+            const size_t n = static_cast<size_t>(outStart[i + 1] - outStart[i]);
+            same = copying[i].size() == n
+                && (n == 0 || std::memcmp(copying[i].data(), outPoints.data() + outStart[i], n * sizeof(ImVec2)) == 0);
+        }
+        printf("%-16s %10zu %12.3f %12.3f %12.3f %10s\n", names[kind], outPoints.size(), copyingMs, scratchMs, batchMs, same ? "yes" : "NO");
+    }
+    printf("\n");
+}
+
+// exp14：2 万个立方体线框，直接透视除法（原来的做法）与先在齐次空间裁剪的对比
+// visible：都在视点前方，约一半在屏幕外；around：立方体散布在视点四周，一半在视点后方
+static void BenchFrustumClip()
+{
+    const int cubeCount = 20000;
+    const FrustumViewport viewport = { 0.0f, 0.0f, 1280.0f, 720.0f };
+    const float nearPlane = 1.0f, farPlane = 100000.0f;
+    static const int edges[] = { 0, 1, 1, 3, 3, 2, 2, 0, 4, 5, 5, 7, 7, 6, 6, 4, 0, 4, 1, 5, 2, 6, 3, 7 };
+    static const int faces[] = { 0, 1, 3, 0, 3, 2, 4, 6, 7, 4, 7, 5, 0, 4, 5, 0, 5, 1,
+        2, 3, 7, 2, 7, 6, 0, 2, 6, 0, 6, 4, 1, 5, 7, 1, 7, 3 };
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    printf("== Homogeneous frustum clipping (%d cubes, 1280x720 viewport) ==\n", cubeCount);
+    printf("%-10s %10s %12s %12s %12s %12s %14s %14s\n", "scene", "naive ms", "naive max", "lines ms", "lines", "outside", "triangles ms", "triangles");
+
+    const char* names[] = { "visible", "around" };
+    for (int kind = 0; kind < 2; ++kind) {
+        // 透视投影：视点在原点看向 -z，水平视角 90 度
+        std::vector<ImVec4> clip(static_cast<size_t>(cubeCount) * 8);
+        for (int c = 0; c < cubeCount; ++c) {
+            const float cz = kind == 0 ? -50.0f - unit(rng) * 3000.0f : (unit(rng) * 2.0f - 1.0f) * 3000.0f;
+            const float spread = kind == 0 ? -cz * 2.0f : 3000.0f;
+            const float cx = (unit(rng) * 2.0f - 1.0f) * spread, cy = (unit(rng) * 2.0f - 1.0f) * spread;
+            for (int k = 0; k < 8; ++k) {
+                const float x = cx + (k & 1 ? 20.0f : -20.0f);
+                const float y = cy + (k & 2 ? 20.0f : -20.0f);
+                const float z = cz + (k & 4 ? 20.0f : -20.0f);
+                const float w = -z;
+                clip[c * 8 + k] = ImVec4(x, y * 1280.0f / 720.0f,
+                    ((farPlane + nearPlane) * w - 2.0f * farPlane * nearPlane) / (farPlane - nearPlane), w);
+            }
+        }
+
+        // 原来的做法：每个顶点直接除以 w，所有边都画
+        std::vector<ImVec2> naive;
+        float naiveMax = 0.0f;
+        double naiveMs = MeasureMs(3, [&]() {
+            naive.clear();
+            for (int c = 0; c < cubeCount; ++c) {
+                ImVec2 screen[8];
+                for (int k = 0; k < 8; ++k) {
+                    const ImVec4& v = clip[c * 8 + k];
+                    screen[k] = ImVec2((v.x / v.w + 1.0f) * 640.0f, (v.y / v.w + 1.0f) * 360.0f);
+                }
+                for (int e = 0; e < 24; e += 2) {
+                    naive.push_back(screen[edges[e]]);
+                    naive.push_back(screen[edges[e + 1]]);
+                }
+            }
+        });
+        for (const ImVec2& p : naive)
+            naiveMax = std::max(naiveMax, std::max(std::fabs(p.x), std::fabs(p.y)));
+
+        FrustumClipScratch scratch;
+        std::vector<ImVec2> cube, lines, triangles;
+        double linesMs = MeasureMs(3, [&]() {
+            lines.clear();
+            for (int c = 0; c < cubeCount; ++c) {
+                ClipProjectLines(clip.data() + c * 8, 8, edges, 12, viewport, cube, scratch);
+                lines.insert(lines.end(), cube.begin(), cube.end());
+            }
+        });
+        double trianglesMs = MeasureMs(3, [&]() {
+            triangles.clear();
+            for (int c = 0; c < cubeCount; ++c) {
+                ClipProjectTriangles(clip.data() + c * 8, 8, faces, 12, viewport, cube, scratch);
+                triangles.insert(triangles.end(), cube.begin(), cube.end());
+            }
+        });
+
+        // 裁剪后的端点都应在视口内（允许舍入误差）
+        size_t outside = 0;
+        for (const ImVec2& p : lines)
+            outside += p.x < -0.01f || p.x > 1280.01f || p.y < -0.01f || p.y > 720.01f ? 1 : 0;
+        printf("%-10s %10.3f %12.3g %12.3f %12zu %12zu %14.3f %14zu\n", names[kind], naiveMs, naiveMax, linesMs,
+            lines.size() / 2, outside, trianglesMs, triangles.size() / 3);
+    }
+    printf("(naive max: largest screen coordinate produced by the raw divide; outside: clipped endpoints off the viewport)\n\n");
+}
+
+static double PolygonArea(const ImVec2* points, int count)
+{
+    double area = 0.0;
+    for (int i = 0, j = count - 1; i < count; j = i++)
+        area += static_cast<double>(points[j].x) * points[i].y - static_cast<double>(points[i].x) * points[j].y;
+    return std::fabs(area) * 0.5;
+}
+
+// exp12：Weiler-Atherton 裁剪带抖动的星形多边形，裁剪多边形为矩形或另一个星形
+// 矩形裁剪的面积与 Sutherland-Hodgman 的结果对比（凸的裁剪窗口两者的面积相同）
+static void BenchWeilerAtherton()
+{
+    printf("== Weiler-Atherton polygon clipping (jittered star subject) ==\n");
+    printf("%-10s %10s %10s %12s %12s %10s %10s\n", "vertices", "rect ms", "polygons", "area error", "star ms", "polygons", "crossings");
+
+    const ClipWindow clipWindow = { 600.0f, 400.0f, 1600.0f, 1400.0f };
+    const ImVec2 rect[] = { ImVec2(600.0f, 400.0f), ImVec2(1600.0f, 400.0f), ImVec2(1600.0f, 1400.0f), ImVec2(600.0f, 1400.0f) };
+    const int counts[] = { 100, 1000, 10000 };
+    for (int count : counts) {
+        std::vector<float> x, y;
+        std::vector<ImVec2> subject(count), clip(count);
+        MakeStarPolygon(count, 1024.0f, 1024.0f, x, y, static_cast<unsigned>(count));
+        for (int i = 0; i < count; ++i)
+            subject[i] = ImVec2(x[i], y[i]);
+        MakeStarPolygon(count, 1174.0f, 1104.0f, x, y, static_cast<unsigned>(count + 1));
+        for (int i = 0; i < count; ++i)
+            clip[i] = ImVec2(x[i], y[i]);
+
+        WeilerAthertonScratch scratch;
+        std::vector<ImVec2> points;
+        std::vector<int> start;
+        int rectPolygons = 0, starPolygons = 0;
+        double rectMs = MeasureMs(5, [&]() { rectPolygons = ClipPolygonWeilerAtherton(subject.data(), count, rect, 4, points, start, scratch); });
+        double area = 0.0;
+        for (int i = 0; i < rectPolygons; ++i)
+            area += PolygonArea(points.data() + start[i], start[i + 1] - start[i]);
+        std::vector<ImVec2> reference;
+        PolygonClipScratch clipScratch;
+        ClipPolygonSutherlandHodgman(subject.data(), count, clipWindow, reference, clipScratch);
+        const double referenceArea = PolygonArea(reference.data(), static_cast<int>(reference.size()));
+
+        double starMs = MeasureMs(5, [&]() { starPolygons = ClipPolygonWeilerAtherton(subject.data(), count, clip.data(), count, points, start, scratch); });
+        printf("%-10d %10.3f %10d %12.2e %12.3f %10d %10zu\n", count, rectMs, rectPolygons, std::fabs(area - referenceArea) / referenceArea,
+            starMs, starPolygons, scratch.subject_crossings.size());
+    }
+    printf("\n");
+}
+
+int main()
+{
+    InitHeadlessImGui();
+
+    BenchLineEmission();
+    BenchCpuRaster();
+    BenchLineBatch();
+    BenchRunSlice();
+    BenchOctantLines();
+    BenchClippedLines();
+    BenchFixedDDA();
+    BenchFilledConics();
+    BenchOffsetCache();
+    BenchEdgeTable();
+    BenchSceneFill();
+    BenchParallelFill();
+    BenchTiledFill();
+    BenchEdgeFlag();
+    BenchCoverageFill();
+    BenchSeedFill();
+    BenchTriangulate();
+    BenchPolygonIndex();
+    BenchRasterCache();
+    BenchBatchClip();
+    BenchLineClipAlgorithms();
+    BenchPolygonClip();
+    BenchFrustumClip();
+    BenchWeilerAtherton();
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}